@@ -0,0 +1,652 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: make_benchmark.c                                                  *
+ *                                                                           *
+ *   Run benchmarks for all pairs of distributions and methods and           *
+ *   write results in machine-readable format (CSV or JSON)                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2006 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#else
+#  error "config.h" required
+#endif
+
+#if defined(HAVE_SCHED_SETAFFINITY) && defined(HAVE_SCHED_H)
+/* sched_setaffinity() is a GNU extension */
+#  define _GNU_SOURCE
+#  include <sched.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
+
+#ifdef HAVE_UNISTD_H
+#  include <unistd.h>
+#endif
+
+#include <unuran.h>
+#include <unuran_tests.h>
+
+/*---------------------------------------------------------------------------*/
+/* define timer (same as in src/tests/timing.c)                              */
+
+#if defined(HAVE_GETTIMEOFDAY) && defined(HAVE_SYS_TIME_H)
+/* use gettimeofday() command. Not in ANSI C! */
+#include <sys/time.h>
+static double get_time(void)
+{ struct timeval tv; gettimeofday(&tv, NULL); return (tv.tv_sec * 1.e6 + tv.tv_usec); }
+#else
+/* use clock() command. ANSI C but less accurate */
+#include <time.h>
+static double get_time(void)
+{ return ( (1.e6 * clock()) / CLOCKS_PER_SEC ); }
+#endif
+
+/* ------------------------------------------------------------------------- */
+
+/* Program name                                                              */
+static const char *progname = "make_benchmark";
+
+/*---------------------------------------------------------------------------*/
+
+extern char *_unur_parser_prepare_string( const char *str );
+
+/*---------------------------------------------------------------------------*/
+
+#define MIN_SETUP_TIME   (1000.)  /* minimal duration for timing setup [us]  */
+#define MAX_SETUP_BATCH  (1000)   /* maximal number of setups per repetition */
+#define UERROR_SAMPLESIZE (100000)/* sample size for estimating u-error      */
+
+#define FORMAT_CSV   1            /* write results as CSV                    */
+#define FORMAT_JSON  2            /* write results as JSON                   */
+
+/* results for one pair of distribution and method */
+struct bench_result {
+  int status;                  /* 1 = o.k., 0 = setup failed                 */
+  double setup[3];             /* setup time [us]: median, 10%, 90%          */
+  double memory;               /* memory used by generator object [bytes]    */
+  double scalar[3];            /* marginal time [ns] using unur_sample_...() */
+  double batch[3];             /* marginal time [ns] using ..._array()       */
+  double uerror_max;           /* maximal u-error (< 0 if not available)     */
+  double uerror_mae;           /* mean absolute u-error                      */
+  double pval;                 /* p-value of chi^2 test (< 0 if n/a)         */
+};
+
+/*---------------------------------------------------------------------------*/
+
+/* print help */
+static void print_usage(void);
+
+/* pin process to given CPU */
+static int pin_cpu( int cpu );
+
+/* read config file */
+static int read_config_file ( const char *filename,
+			      struct unur_slist *distr_str_list,
+			      struct unur_slist *meth_str_list );
+
+/* run benchmark for distribution and method */
+static int run_benchmark( UNUR_DISTR *distr, const char *methstr,
+			  int samplesize, int n_rep, int warmup,
+			  struct bench_result *res );
+
+/* compute median and 10% and 90% percentiles of array */
+static void get_percentiles( double *x, int n, double *q );
+
+/* print results */
+static void print_header( int format );
+static void print_result( int format, int first,
+			  const char *distrstr, const char *methstr,
+			  const struct bench_result *res );
+static void print_footer( int format );
+
+/*---------------------------------------------------------------------------*/
+/* print usage */
+
+void
+print_usage(void)
+{
+
+#if HAVE_DECL_GETOPT
+
+  fprintf(stderr,"\n%s [-D] [-j] [-n size] [-r rep] [-w size] [-c cpu] conffile\n",progname);
+  fprintf(stderr,"\n");
+  fprintf(stderr,"Run benchmarks for all pairs of distributions and methods:\n");
+  fprintf(stderr,"setup time, memory, marginal generation times (single and array),\n");
+  fprintf(stderr,"u-error (inversion methods only) and p-value of chi^2 test.\n");
+  fprintf(stderr,"Timings are reported as median, 10%% and 90%% percentiles.\n");
+  fprintf(stderr,"\n");
+  fprintf(stderr,"Arguments:\n");
+  fprintf(stderr,"\t-D          ... debug mode\n");
+  fprintf(stderr,"\t-j          ... write JSON (default: CSV)\n");
+  fprintf(stderr,"\t-n size     ... size of sample for each repetition (default: 100000)\n");
+  fprintf(stderr,"\t-r rep      ... number of repetitions (default: 11)\n");
+  fprintf(stderr,"\t-w size     ... size of sample for warm-up (default: 10000)\n");
+  fprintf(stderr,"\t-c cpu      ... pin process to given CPU (default: no pinning)\n");
+  fprintf(stderr,"\t   conffile ... file with list of distributions and methods\n");
+  fprintf(stderr,"\n");
+
+#else
+
+  fprintf(stderr,"\n%s conffile [samplesize]\n",progname);
+  fprintf(stderr,"\n");
+  fprintf(stderr,"Run benchmarks for all pairs of distributions and methods.\n");
+  fprintf(stderr,"\n");
+  fprintf(stderr,"Arguments:\n");
+  fprintf(stderr,"\tconffile   ... file with list of distributions and methods\n");
+  fprintf(stderr,"\tsamplesize ... size of sample (default: 100000)\n");
+  fprintf(stderr,"\n");
+
+#endif
+
+} /* end of print_usage() */
+
+/*****************************************************************************/
+
+int main (int argc, char *argv[])
+{
+  /* defaults */
+  int debug = 0;            /* debug mode (on/off) */
+  int format = FORMAT_CSV;  /* output format */
+  int samplesize = 100000;  /* size of samples */
+  int n_rep = 11;           /* number of repetitions */
+  int warmup = 10000;       /* size of sample for warm-up */
+  int cpu = -1;             /* CPU (< 0 --> no pinning) */
+  char *conffile;           /* name of configuration file */
+
+  struct unur_slist *distr_str_list; /* list of strings for distributions */
+  struct unur_slist *meth_str_list;  /* list of strings for methods */
+  int n_distr, n_meth;               /* number of distributions and methods */
+  char *distrstr, *methstr;
+  UNUR_DISTR *distr;
+  struct bench_result res;
+  int i, k, first;
+
+  /* ------------------------------------------------------------------------*/
+  /* read parameters                                                         */
+
+#if HAVE_DECL_GETOPT
+
+  int c;
+
+  while ((c = getopt(argc, argv, "Djn:r:w:c:")) != -1) {
+    switch (c) {
+    case 'D':     /* debug */
+      debug = 1;
+      break;
+    case 'j':     /* JSON */
+      format = FORMAT_JSON;
+      break;
+    case 'n':     /* sample size */
+      samplesize = atoi(optarg);
+      break;
+    case 'r':     /* repetitions */
+      n_rep = atoi(optarg);
+      break;
+    case 'w':     /* warm-up */
+      warmup = atoi(optarg);
+      break;
+    case 'c':     /* CPU */
+      cpu = atoi(optarg);
+      break;
+    case '?':     /* Help Message  */
+    case 'h':
+    default:
+      print_usage(); exit (EXIT_FAILURE);
+    }
+  }
+
+  /* name of configuration file */
+  if (optind >= argc) { print_usage(); exit (EXIT_FAILURE); }
+  conffile = argv[optind];
+
+#else
+
+  /* name of configuration file */
+  if (argc<2) { print_usage(); exit (EXIT_FAILURE); }
+  conffile = argv[1];
+
+  /* sample size */
+  if (argc >= 3)
+    samplesize = atoi(argv[2]);
+
+#endif
+
+  if (samplesize < 1 || n_rep < 1 || warmup < 0) {
+    print_usage(); exit (EXIT_FAILURE);
+  }
+
+  /* ------------------------------------------------------------------------*/
+
+  /* debugging and logging information */
+  if (debug)
+    unur_set_default_debug(~0u);  /* on */
+  else
+    unur_set_default_debug(0u);   /* off */
+
+  /* pin process */
+  if (cpu >= 0 && !pin_cpu(cpu))
+    fprintf(stderr,"warning: cannot pin process to CPU %d\n",cpu);
+
+  /* create lists for distributions and methods */
+  distr_str_list = _unur_slist_new();
+  meth_str_list  = _unur_slist_new();
+
+  /* read config file */
+  read_config_file(conffile, distr_str_list, meth_str_list);
+
+  /* get number of distributions and methods */
+  n_distr = _unur_slist_length(distr_str_list);
+  n_meth  = _unur_slist_length(meth_str_list);
+
+  /* run benchmarks */
+  print_header(format);
+  first = TRUE;
+  for (i=0; i<n_distr; i++) {
+    distrstr = _unur_slist_get(distr_str_list,i);
+    distr = unur_str2distr(distrstr);
+    if (distr == NULL) {
+      fprintf(stderr,"syntax error: %s\n",distrstr);
+      exit (EXIT_FAILURE);
+    }
+    for (k=0; k<n_meth; k++) {
+      methstr = _unur_slist_get(meth_str_list,k);
+      run_benchmark(distr, methstr, samplesize, n_rep, warmup, &res);
+      print_result(format, first, distrstr, methstr, &res);
+      first = FALSE;
+    }
+    unur_distr_free(distr);
+  }
+  print_footer(format);
+
+  /* free memory */
+  _unur_slist_free(distr_str_list);
+  _unur_slist_free(meth_str_list);
+
+  exit (EXIT_SUCCESS);
+
+} /* end of main() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+pin_cpu( int cpu )
+     /* pin process to given CPU */
+{
+#if defined(HAVE_SCHED_SETAFFINITY) && defined(HAVE_SCHED_H)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return (sched_setaffinity(0, sizeof(set), &set) == 0);
+#else
+  return 0;
+#endif
+} /* end of pin_cpu() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+read_config_file ( const char *filename,
+		   struct unur_slist *distr_str_list, struct unur_slist *meth_str_list )
+     /* read config file */
+{
+#define LINELENGTH  10240      /* max length of lines allowed    */
+
+  char line[LINELENGTH];      /* input buffer */
+  char *str;                  /* pointer to working string */
+
+  FILE *fh;                   /* file handle for input stream */
+  int line_no;                /* counter for lines */
+
+  /* open the file with the data read-only */
+  fh = fopen(filename, "r");
+  if (fh == NULL) {
+    fprintf(stderr,"error: cannot open config file `%s'.\n",filename);
+    exit(EXIT_FAILURE);
+  }
+
+  /* read lines until eof */
+  line_no = 0;
+  while( fgets(line, LINELENGTH, fh) ) {
+    ++line_no;
+
+    /* make a working copy of the line;                           */
+    /* remove all white spaces and convert to lower case letters. */
+    str = _unur_parser_prepare_string( line );
+
+    /* ignore all lines that do not start with a letter */
+    if ( ! isalpha(str[0]) || str[0] == '#') {
+      free(str);
+      continue;
+    }
+
+    /* store distribution object */
+    if ( strncmp( str, "distr", (size_t)5)==0 ) {
+      _unur_slist_append(distr_str_list,str);
+      continue;
+    }
+
+    /* store method (parameter object) */
+    if ( strncmp( str, "method=", (size_t)7)==0 ) {
+      _unur_slist_append(meth_str_list,str);
+      continue;
+    }
+
+    fprintf(stderr,"syntax error in line %d: %s\n",line_no,str);
+    exit (EXIT_FAILURE);
+  }
+
+  /* close input stream */
+  fclose(fh);
+
+  /* check number of distributions and methods */
+  if ( _unur_slist_length(distr_str_list) == 0 ||
+       _unur_slist_length(meth_str_list)  == 0 ) {
+    fprintf(stderr,"error: no distributions or methods given.\n");
+    exit (EXIT_FAILURE);
+  }
+
+  /* o.k. */
+  return 1;
+
+#undef LINELENGTH
+
+} /* end of read_config_file() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+run_benchmark( UNUR_DISTR *distr, const char *methstr,
+	       int samplesize, int n_rep, int warmup,
+	       struct bench_result *res )
+     /* run benchmark for distribution and method */
+{
+  struct unur_slist *mlist = NULL;  /* list of allocated memory
+				       blocks in running _unur_str2par() */
+  struct unur_slist **mlists;       /* one such list for each setup */
+  UNUR_PAR *p;        /* parameter object */
+  UNUR_PAR **par;     /* list of parameter objects */
+  UNUR_GEN *gen;      /* generator object used for sampling */
+  UNUR_GEN **glist;   /* list of generator objects */
+  double *times;      /* timing results for repetitions */
+  double *X = NULL;   /* array for continuous sample */
+  int *K = NULL;      /* array for discrete sample */
+  int is_discr;       /* whether generator is discrete */
+  double sum;         /* dummy variable to avoid optimizing away */
+  double t0, t1;
+  int n_setup;        /* number of setups per repetition */
+  int r, j;
+
+  /* defaults */
+  res->status = 0;
+  for (j=0; j<3; j++)
+    res->setup[j] = res->scalar[j] = res->batch[j] = -1.;
+  res->memory = -1.;
+  res->uerror_max = res->uerror_mae = -1.;
+  res->pval = -1.;
+
+  /* only univariate distributions */
+  switch (unur_distr_get_type(distr)) {
+  case UNUR_DISTR_CONT:
+  case UNUR_DISTR_CEMP:
+    is_discr = FALSE; break;
+  case UNUR_DISTR_DISCR:
+    is_discr = TRUE; break;
+  default:
+    return 0;
+  }
+
+  /* first setup: check method and estimate setup time */
+  p = _unur_str2par(distr, methstr, &mlist);
+  if (p == NULL) { _unur_slist_free(mlist); return 0; }
+  t0 = get_time();
+  gen = unur_init(p);
+  t1 = get_time();
+  _unur_slist_free(mlist); mlist = NULL;
+  if (gen == NULL) return 0;
+  res->memory = (double) unur_gen_get_memory_usage(gen);
+
+  /* number of setups per repetition */
+  n_setup = (t1 - t0 > 0.) ? (int) (MIN_SETUP_TIME / (t1 - t0)) : MAX_SETUP_BATCH;
+  if (n_setup < 1) n_setup = 1;
+  if (n_setup > MAX_SETUP_BATCH) n_setup = MAX_SETUP_BATCH;
+
+  times = malloc(n_rep * sizeof(double));
+  par = malloc(n_setup * sizeof(UNUR_PAR *));
+  glist = malloc(n_setup * sizeof(UNUR_GEN *));
+  mlists = malloc(n_setup * sizeof(struct unur_slist *));
+
+  /* -- setup time -------------------------------------------------------- */
+  /* parsing of method string is not included */
+  for (r=0; r<n_rep; r++) {
+    for (j=0; j<n_setup; j++) {
+      mlists[j] = NULL;
+      par[j] = _unur_str2par(distr, methstr, &(mlists[j]));
+    }
+    t0 = get_time();
+    for (j=0; j<n_setup; j++)
+      glist[j] = unur_init(par[j]);
+    t1 = get_time();
+    for (j=0; j<n_setup; j++) {
+      unur_free(glist[j]);
+      _unur_slist_free(mlists[j]);
+    }
+    times[r] = (t1 - t0) / n_setup;
+  }
+  get_percentiles(times, n_rep, res->setup);
+
+  /* -- warm-up ----------------------------------------------------------- */
+  sum = 0.;
+  for (j=0; j<warmup; j++)
+    sum += (is_discr) ? unur_sample_discr(gen) : unur_sample_cont(gen);
+
+  /* -- marginal generation time: single calls ---------------------------- */
+  for (r=0; r<n_rep; r++) {
+    t0 = get_time();
+    if (is_discr)
+      for (j=0; j<samplesize; j++) sum += unur_sample_discr(gen);
+    else
+      for (j=0; j<samplesize; j++) sum += unur_sample_cont(gen);
+    t1 = get_time();
+    times[r] = 1000. * (t1 - t0) / samplesize;
+  }
+  get_percentiles(times, n_rep, res->scalar);
+
+  /* -- marginal generation time: arrays ---------------------------------- */
+  if (is_discr) K = malloc(samplesize * sizeof(int));
+  else          X = malloc(samplesize * sizeof(double));
+  for (r=0; r<n_rep; r++) {
+    t0 = get_time();
+    if (is_discr) unur_sample_discr_array(gen, K, samplesize);
+    else          unur_sample_cont_array(gen, X, samplesize);
+    t1 = get_time();
+    times[r] = 1000. * (t1 - t0) / samplesize;
+  }
+  get_percentiles(times, n_rep, res->batch);
+  sum += (is_discr) ? K[0] : X[0];
+
+  /* -- accuracy ---------------------------------------------------------- */
+  if (unur_gen_is_inversion(gen))
+    unur_test_u_error(gen, &(res->uerror_max), &(res->uerror_mae), 1.e-10,
+		      UERROR_SAMPLESIZE, TRUE, FALSE, FALSE, NULL);
+
+  res->pval = unur_test_chi2(gen, 0, 0, 0, 0, NULL);
+
+  /* avoid that compiler removes sampling loops */
+  if (sum == 0.123456789) fprintf(stderr," ");
+
+  res->status = 1;
+
+  /* free memory */
+  unur_free(gen);
+  free(times);
+  free(par);
+  free(glist);
+  free(mlists);
+  if (X) free(X);
+  if (K) free(K);
+
+  return 1;
+} /* end of run_benchmark() */
+
+/*---------------------------------------------------------------------------*/
+
+/* compare two doubles (needed for sorting) */
+static int
+compare_doubles (const void *a, const void *b)
+{
+  const double *da = (const double *) a;
+  const double *db = (const double *) b;
+  return (*da > *db) - (*da < *db);
+}
+
+void
+get_percentiles( double *x, int n, double *q )
+     /* compute median and 10% and 90% percentiles of array */
+     /* (array x is sorted)                                 */
+{
+  qsort( x, (size_t)n, sizeof(double), compare_doubles);
+  q[0] = (n%2) ? x[n/2] : 0.5 * (x[n/2-1] + x[n/2]);
+  q[1] = x[(int)(0.1*(n-1)+0.5)];
+  q[2] = x[(int)(0.9*(n-1)+0.5)];
+} /* end of get_percentiles() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+print_header( int format )
+     /* print header */
+{
+  switch (format) {
+  case FORMAT_JSON:
+    printf("[\n");
+    break;
+  case FORMAT_CSV:
+  default:
+    printf("distribution,method,status,"
+	   "setup_us,setup_us_p10,setup_us_p90,memory_bytes,"
+	   "sample_ns,sample_ns_p10,sample_ns_p90,"
+	   "array_ns,array_ns_p10,array_ns_p90,"
+	   "uerror_max,uerror_mae,chi2_pval\n");
+  }
+} /* end of print_header() */
+
+/*---------------------------------------------------------------------------*/
+
+static void
+print_value( int format, const char *name, double x )
+     /* print value (or "not available") */
+{
+  switch (format) {
+  case FORMAT_JSON:
+    if (x < 0.) printf(", \"%s\": null", name);
+    else        printf(", \"%s\": %.6g", name, x);
+    break;
+  case FORMAT_CSV:
+  default:
+    if (x < 0.) printf(",NA");
+    else        printf(",%.6g", x);
+  }
+} /* end of print_value() */
+
+/*---------------------------------------------------------------------------*/
+
+static void
+print_string( int format, const char *name, const char *str )
+     /* print string (quotes are replaced) */
+{
+  const char *c;
+
+  if (format == FORMAT_JSON)
+    printf("\"%s\": \"", name);
+  else
+    printf("\"");
+
+  for (c=str; *c; c++)
+    putchar( (*c == '"') ? '\'' : *c );
+  printf("\"");
+} /* end of print_string() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+print_result( int format, int first,
+	      const char *distrstr, const char *methstr,
+	      const struct bench_result *res )
+     /* print results for pair of distribution and method */
+{
+  if (format == FORMAT_JSON)
+    printf("%s  { ", first ? "" : ",\n");
+
+  print_string(format,"distribution",distrstr);
+  printf( (format == FORMAT_JSON) ? ", " : "," );
+  print_string(format,"method",methstr);
+
+  if (format == FORMAT_JSON)
+    printf(", \"status\": \"%s\"", res->status ? "ok" : "failed");
+  else
+    printf(",%s", res->status ? "ok" : "failed");
+
+  print_value(format,"setup_us",res->setup[0]);
+  print_value(format,"setup_us_p10",res->setup[1]);
+  print_value(format,"setup_us_p90",res->setup[2]);
+  print_value(format,"memory_bytes",res->memory);
+  print_value(format,"sample_ns",res->scalar[0]);
+  print_value(format,"sample_ns_p10",res->scalar[1]);
+  print_value(format,"sample_ns_p90",res->scalar[2]);
+  print_value(format,"array_ns",res->batch[0]);
+  print_value(format,"array_ns_p10",res->batch[1]);
+  print_value(format,"array_ns_p90",res->batch[2]);
+  print_value(format,"uerror_max",res->uerror_max);
+  print_value(format,"uerror_mae",res->uerror_mae);
+  print_value(format,"chi2_pval",res->pval);
+
+  if (format == FORMAT_JSON)
+    printf(" }");
+  else
+    printf("\n");
+
+  fflush(stdout);
+} /* end of print_result() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+print_footer( int format )
+     /* print footer */
+{
+  if (format == FORMAT_JSON)
+    printf("\n]\n");
+} /* end of print_footer() */
+
+/*---------------------------------------------------------------------------*/
@@ -110,6 +110,7 @@ unur_distr_cemp_new( void )
   /* observed sample */
   DISTR.sample    = NULL;   /* sample      */
   DISTR.n_sample  = 0;      /* sample size */
+  DISTR.sample_is_ref = FALSE; /* sample is owned by distribution object */
 
   /* histogram */
   DISTR.n_hist    = 0;          /* number of bins          */
@@ -152,8 +153,9 @@ _unur_distr_cemp_clone( const struct unur_distr *distr )
   /* copy distribution object into clone */
   memcpy( clone, distr, sizeof( struct unur_distr ) );
 
-  /* copy data about sample into generator object (when there is one) */
-  if (DISTR.sample) {
+  /* copy data about sample into generator object (when there is one).   */
+  /* a sample owned by the caller is not copied but shared by the clone. */
+  if (DISTR.sample && !DISTR.sample_is_ref) {
     CLONE.sample = _unur_xmalloc( DISTR.n_sample * sizeof(double) );
     memcpy( CLONE.sample, DISTR.sample, DISTR.n_sample * sizeof(double) );
   }
@@ -198,7 +200,7 @@ _unur_distr_cemp_free( struct unur_distr *distr )
 
   COOKIE_CHECK(distr,CK_DISTR_CEMP,RETURN_VOID);
 
-  if (DISTR.sample)    free( DISTR.sample );
+  if (DISTR.sample && !DISTR.sample_is_ref) free( DISTR.sample );
   if (DISTR.hist_prob) free( DISTR.hist_prob );
   if (DISTR.hist_bins) free( DISTR.hist_bins );
   if (distr->name_str) free(distr->name_str);
@@ -236,6 +238,9 @@ unur_distr_cemp_set_data( struct unur_distr *distr, const double *sample, int n_
     return UNUR_ERR_DISTR_SET;
   }
 
+  /* remove old sample */
+  if (DISTR.sample && !DISTR.sample_is_ref) free( DISTR.sample );
+
   /* allocate memory for sample */
   DISTR.sample = _unur_xmalloc( n_sample * sizeof(double) );
   if (!DISTR.sample) return UNUR_ERR_MALLOC;
@@ -243,6 +248,7 @@ unur_distr_cemp_set_data( struct unur_distr *distr, const double *sample, int n_
   /* copy observed sample */
   memcpy( DISTR.sample, sample, n_sample * sizeof(double) );
   DISTR.n_sample = n_sample;
+  DISTR.sample_is_ref = FALSE;
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -251,6 +257,52 @@ unur_distr_cemp_set_data( struct unur_distr *distr, const double *sample, int n_
 
 /*---------------------------------------------------------------------------*/
 
+int
+unur_distr_cemp_set_data_ref( struct unur_distr *distr, const double *sample, int n_sample )
+     /*----------------------------------------------------------------------*/
+     /* set observed sample for distribution without copying it.             */
+     /* The array must not be changed or freed as long as the distribution   */
+     /* object or any generator object built from it is in use.             */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   distr    ... pointer to distribution object                        */
+     /*   sample   ... pointer to array of observations                      */
+     /*   n_sample ... number of observations (sample size)                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
+  _unur_check_distr_object( distr, CEMP, UNUR_ERR_DISTR_INVALID );
+  _unur_check_NULL( distr->name, sample, UNUR_ERR_NULL );
+
+  /* check new parameter for generator */
+  if (n_sample <= 0) {
+    _unur_error(NULL,UNUR_ERR_DISTR_SET,"sample size");
+    return UNUR_ERR_DISTR_SET;
+  }
+
+  /* remove old sample */
+  if (DISTR.sample && !DISTR.sample_is_ref) free( DISTR.sample );
+
+  /* store pointer to observed sample.                           */
+  /* (the sample is never modified by UNU.RAN; we have to cast   */
+  /* away the const qualifier as the same pointer is used for    */
+  /* samples owned by the distribution object.)                  */
+  DISTR.sample = (double *) sample;
+  DISTR.n_sample = n_sample;
+  DISTR.sample_is_ref = TRUE;
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+
+} /* end of unur_distr_cemp_set_data_ref() */
+
+/*---------------------------------------------------------------------------*/
+
 int
 unur_distr_cemp_read_data( struct unur_distr *distr, const char *filename )
      /*----------------------------------------------------------------------*/
@@ -269,6 +321,11 @@ unur_distr_cemp_read_data( struct unur_distr *distr, const char *filename )
   _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
   _unur_check_distr_object( distr, CEMP, UNUR_ERR_DISTR_INVALID );
 
+  /* remove old sample */
+  if (DISTR.sample && !DISTR.sample_is_ref) free( DISTR.sample );
+  DISTR.sample = NULL;
+  DISTR.sample_is_ref = FALSE;
+
   /* read data from file */
   DISTR.n_sample = _unur_read_data( filename, 1, &(DISTR.sample) );
 
@@ -81,6 +81,21 @@ int unur_distr_cemp_set_data( UNUR_DISTR *distribution, const double *sample, in
    Set observed sample for empirical distribution.
 */
 
+int unur_distr_cemp_set_data_ref( UNUR_DISTR *distribution, const double *sample, int n_sample );
+/* 
+   Set observed sample for empirical distribution.
+   Contrary to unur_distr_cemp_set_data() the array @var{sample} is
+   not copied into the distribution object. Instead the distribution
+   object as well as all clones of it and all generator objects
+   created from it only store a pointer to @var{sample}.
+   Thus this array may be a huge read-only (e.g. memory-mapped)
+   array which is owned by the caller. It must not be changed or freed
+   as long as any of these objects is in use.
+
+   UNU.RAN never modifies the given data. Methods that require sorted
+   data (like EMPL) make a private copy.
+*/
+
 int unur_distr_cemp_read_data( UNUR_DISTR *distribution, const char *filename );
 /* 
    Read data from file @file{filename}.
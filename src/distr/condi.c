@@ -242,6 +242,7 @@ unur_distr_condi_set_condition( struct unur_distr *condi, const double *pos, con
 
   /* changelog */
   condi->set &= ~UNUR_DISTR_SET_MODE; /* mode unknown */
+  _unur_distr_cont_clear_pdfcache(condi);
 
   /* o.k. */
   return UNUR_SUCCESS;
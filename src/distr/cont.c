@@ -52,6 +52,9 @@
    data of underlying distributions */
 #define BASE  distr->base->data.cont
 
+/* maximal number of entries in cache for PDF values */
+#define MAX_PDFCACHE  (1048576)
+
 /*---------------------------------------------------------------------------*/
 
 static double _unur_distr_cont_eval_pdf_tree( double x, const struct unur_distr *distr );
@@ -88,6 +91,11 @@ static double _unur_aux_pdf(double x, void *p);
 /* Auxiliary function used in the computation of the mode                    */
 /*---------------------------------------------------------------------------*/
 
+static unsigned _unur_distr_cont_cache_hash( double x );
+/*---------------------------------------------------------------------------*/
+/* compute hash value for argument x of PDF.                                 */
+/*---------------------------------------------------------------------------*/
+
 /*****************************************************************************/
 /**                                                                         **/
 /** univariate continuous distributions                                     **/
@@ -183,6 +191,8 @@ unur_distr_cont_new( void )
   DISTR.logcdftree = NULL;         /* pointer to function tree for logCDF    */
   DISTR.hrtree     = NULL;         /* pointer to function tree for HR        */
 
+  DISTR.pdfcache   = NULL;         /* cache for PDF values (default: none)   */
+
   /* return pointer to object */
   return distr;
 
@@ -228,6 +238,15 @@ _unur_distr_cont_clone( const struct unur_distr *distr )
   CLONE.cdftree  = (DISTR.cdftree)  ? _unur_fstr_dup_tree(DISTR.cdftree)  : NULL;
   CLONE.logcdftree  = (DISTR.logcdftree)  ? _unur_fstr_dup_tree(DISTR.logcdftree)  : NULL;
   CLONE.hrtree   = (DISTR.hrtree)   ? _unur_fstr_dup_tree(DISTR.hrtree)   : NULL;
+
+  /* copy cache for PDF values (including its entries) */
+  if (DISTR.pdfcache) {
+    size_t size = (DISTR.pdfcache->mask + 1) * sizeof(struct unur_distr_cont_cache_entry);
+    CLONE.pdfcache = _unur_xmalloc( sizeof(struct unur_distr_cont_cache) );
+    memcpy( CLONE.pdfcache, DISTR.pdfcache, sizeof(struct unur_distr_cont_cache) );
+    CLONE.pdfcache->entry = _unur_xmalloc( size );
+    memcpy( CLONE.pdfcache->entry, DISTR.pdfcache->entry, size );
+  }
  
   /* clone of parameter arrays */  
   for (i=0; i<UNUR_DISTR_MAXPARAMS; i++) {
@@ -296,6 +315,12 @@ _unur_distr_cont_free( struct unur_distr *distr )
   if (DISTR.logcdftree)  _unur_fstr_free(DISTR.logcdftree);
   if (DISTR.hrtree)   _unur_fstr_free(DISTR.hrtree);
 
+  /* cache for PDF values */
+  if (DISTR.pdfcache) {
+    free(DISTR.pdfcache->entry);
+    free(DISTR.pdfcache);
+  }
+
   /* derived distribution */
   if (distr->base) _unur_distr_free(distr->base);
 
@@ -339,6 +364,7 @@ unur_distr_cont_set_pdf( struct unur_distr *distr, UNUR_FUNCT_CONT *pdf )
   /* changelog */
   distr->set &= ~UNUR_DISTR_SET_MASK_DERIVED;
   /* derived parameters like mode, area, etc. might be wrong now! */
+  _unur_distr_cont_clear_pdfcache(distr);
 
   DISTR.pdf = pdf;
   return UNUR_SUCCESS;
@@ -416,6 +442,7 @@ unur_distr_cont_set_logpdf( struct unur_distr *distr, UNUR_FUNCT_CONT *logpdf )
   /* changelog */
   distr->set &= ~UNUR_DISTR_SET_MASK_DERIVED;
   /* derived parameters like mode, area, etc. might be wrong now! */
+  _unur_distr_cont_clear_pdfcache(distr);
 
   DISTR.logpdf = logpdf;
   DISTR.pdf = _unur_distr_cont_eval_pdf_from_logpdf;
@@ -740,6 +767,7 @@ unur_distr_cont_set_pdfstr( struct unur_distr *distr, const char *pdfstr )
   /* changelog */
   distr->set &= ~UNUR_DISTR_SET_MASK_DERIVED;
   /* derived parameters like mode, area, etc. might be wrong now! */
+  _unur_distr_cont_clear_pdfcache(distr);
 
   /* parse PDF string */
   if ( (DISTR.pdftree = _unur_fstr2tree(pdfstr)) == NULL ) {
@@ -804,6 +832,7 @@ unur_distr_cont_set_logpdfstr( struct unur_distr *distr, const char *logpdfstr )
   /* changelog */
   distr->set &= ~UNUR_DISTR_SET_MASK_DERIVED;
   /* derived parameters like mode, area, etc. might be wrong now! */
+  _unur_distr_cont_clear_pdfcache(distr);
 
   /* parse logPDF string */
   if ( (DISTR.logpdftree = _unur_fstr2tree(logpdfstr)) == NULL ) {
@@ -1023,7 +1052,8 @@ _unur_distr_cont_eval_dpdf_tree( double x, const struct unur_distr *distr )
      /*   derivative of PDF at x                                             */
      /*----------------------------------------------------------------------*/
 {
-  return ((DISTR.dpdftree) ? _unur_fstr_eval_tree(DISTR.dpdftree,x) : UNUR_INFINITY);
+  /* the derivative is computed directly from the tree for the PDF */
+  return ((DISTR.pdftree) ? _unur_fstr_eval_deriv_tree(DISTR.pdftree,x,NULL) : UNUR_INFINITY);
 } /* end of _unur_distr_cont_eval_dpdf_tree() */
 
 /*---------------------------------------------------------------------------*/
@@ -1042,8 +1072,9 @@ _unur_distr_cont_eval_dlogpdf_tree( double x, const struct unur_distr *distr )
      /*   derivative of logPDF at x                                          */
      /*----------------------------------------------------------------------*/
 {
-  return ((DISTR.dlogpdftree) ? _unur_fstr_eval_tree(DISTR.dlogpdftree,x) : UNUR_INFINITY);
-} /* end of _unur_distr_cont_eval_dpdf_tree() */
+  /* the derivative is computed directly from the tree for the logPDF */
+  return ((DISTR.logpdftree) ? _unur_fstr_eval_deriv_tree(DISTR.logpdftree,x,NULL) : UNUR_INFINITY);
+} /* end of _unur_distr_cont_eval_dlogpdf_tree() */
 
 /*---------------------------------------------------------------------------*/
 
@@ -1702,6 +1733,10 @@ unur_distr_cont_set_pdfparams( struct unur_distr *distr, const double *params, i
   /* changelog */
   distr->set &= ~UNUR_DISTR_SET_MASK_DERIVED;
   /* derived parameters like mode, area, etc. might be wrong now! */
+  _unur_distr_cont_clear_pdfcache(distr);
+  if (distr->base && distr->base->type == UNUR_DISTR_CONT)
+    /* the PDF of a derived distribution depends on the underlying one */
+    _unur_distr_cont_clear_pdfcache(distr->base);
 
   /* even if the set routine fails, the derived parameters are
      marked as unknown. but this is o.k. since in this case something
@@ -1797,8 +1832,9 @@ unur_distr_cont_set_pdfparams_vec( struct unur_distr *distr, int par, const doub
   }
 
   if (param_vec != NULL) {
-    /* allocate memory */
-    DISTR.param_vecs[par] = _unur_xrealloc( DISTR.param_vecs[par], n_param_vec * sizeof(double) );
+    /* allocate memory (unless we can reuse the old array) */
+    if (DISTR.param_vecs[par] == NULL || DISTR.n_param_vec[par] != n_param_vec)
+      DISTR.param_vecs[par] = _unur_xrealloc( DISTR.param_vecs[par], n_param_vec * sizeof(double) );
     /* copy parameters */
     memcpy( DISTR.param_vecs[par], param_vec, n_param_vec*sizeof(double) );
     /* set length of array */
@@ -1813,6 +1849,7 @@ unur_distr_cont_set_pdfparams_vec( struct unur_distr *distr, int par, const doub
   /* changelog */
   distr->set &= ~UNUR_DISTR_SET_MASK_DERIVED;
   /* derived parameters like mode, area, etc. might be wrong now! */
+  _unur_distr_cont_clear_pdfcache(distr);
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -1929,6 +1966,7 @@ unur_distr_cont_set_domain( struct unur_distr *distr, double left, double right
 		  UNUR_DISTR_SET_TRUNCATED | 
 		  UNUR_DISTR_SET_MASK_DERIVED );
   distr->set |= is_set;
+  _unur_distr_cont_clear_pdfcache(distr);
 
   if (distr->base) {
     /* for derived distributions (e.g. order statistics)
@@ -2327,6 +2365,187 @@ unur_distr_cont_get_pdfarea( struct unur_distr *distr )
 
 } /* end of unur_distr_cont_get_pdfarea() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+unur_distr_cont_set_pdfcache( struct unur_distr *distr, int size )
+     /*----------------------------------------------------------------------*/
+     /* set size of cache for values of PDF and logPDF                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   distr ... pointer to distribution object                           */
+     /*   size  ... number of entries in cache (0 = no cache)                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned n;
+
+  /* check arguments */
+  _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
+  _unur_check_distr_object( distr, CONT, UNUR_ERR_DISTR_INVALID );
+
+  /* check new parameter for distribution */
+  if (size < 0 || size > MAX_PDFCACHE) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_SET,"size of PDF cache");
+    return UNUR_ERR_DISTR_SET;
+  }
+
+  /* remove old cache */
+  if (DISTR.pdfcache) {
+    free(DISTR.pdfcache->entry);
+    free(DISTR.pdfcache);
+    DISTR.pdfcache = NULL;
+  }
+
+  if (size == 0)
+    /* no cache */
+    return UNUR_SUCCESS;
+
+  /* size of table must be a power of 2 */
+  for (n=16u; n < (unsigned) size; n <<= 1) ;
+
+  DISTR.pdfcache = _unur_xmalloc( sizeof(struct unur_distr_cont_cache) );
+  DISTR.pdfcache->entry = _unur_xmalloc( n * sizeof(struct unur_distr_cont_cache_entry) );
+  DISTR.pdfcache->mask = n - 1u;
+  _unur_distr_cont_clear_pdfcache(distr);
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+} /* end of unur_distr_cont_set_pdfcache() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_distr_cont_clear_pdfcache( struct unur_distr *distr )
+     /*----------------------------------------------------------------------*/
+     /* remove all entries from cache for PDF values.                        */
+     /* (must be called whenever PDF or its parameters are changed.)         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   distr ... pointer to distribution object                           */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned i;
+
+  if (DISTR.pdfcache) {
+    for (i=0; i<=DISTR.pdfcache->mask; i++)
+      DISTR.pdfcache->entry[i].has = 0u;
+    DISTR.pdfcache->n_hits = 0ul;
+    DISTR.pdfcache->n_misses = 0ul;
+  }
+
+} /* end of _unur_distr_cont_clear_pdfcache() */
+
+/*---------------------------------------------------------------------------*/
+
+unsigned
+_unur_distr_cont_cache_hash( double x )
+     /*----------------------------------------------------------------------*/
+     /* compute hash value for argument x of PDF from its bit pattern.       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   x ... argument of PDF                                              */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   hash value                                                         */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned w[sizeof(double)/sizeof(unsigned)];
+  unsigned h = 0u;
+  size_t i;
+
+  memcpy(w, &x, sizeof(w));
+  for (i=0; i < sizeof(double)/sizeof(unsigned); i++)
+    h = (h ^ w[i]) * 0x9e3779b1u;
+
+  return (h ^ (h >> 16)) & 0xffffffffu;
+} /* end of _unur_distr_cont_cache_hash() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_distr_cont_eval_pdf_cached( double x, const struct unur_distr *distr )
+     /*----------------------------------------------------------------------*/
+     /* evaluate PDF at x. the result is looked up in (and stored into) the  */
+     /* cache of the distribution object.                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   x     ... argument for PDF                                         */
+     /*   distr ... pointer to distribution object                           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   PDF(x)                                                             */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_distr_cont_cache *cache = DISTR.pdfcache;
+  struct unur_distr_cont_cache_entry *entry;
+  double fx;
+
+  entry = cache->entry + (_unur_distr_cont_cache_hash(x) & cache->mask);
+  if ((entry->has & 1u) && entry->x == x) {
+    ++(cache->n_hits);
+    return entry->pdf;
+  }
+
+  /* not in cache */
+  ++(cache->n_misses);
+  fx = (*(DISTR.pdf))(x,distr);
+
+  /* store in cache.                                    */
+  /* (the PDF may be computed by means of the logPDF    */
+  /* which then has already been stored in this entry.) */
+  if (! ((entry->has & 2u) && entry->x == x)) 
+    entry->has = 0u;
+  entry->x = x;
+  entry->pdf = fx;
+  entry->has |= 1u;
+
+  return fx;
+} /* end of _unur_distr_cont_eval_pdf_cached() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_distr_cont_eval_logpdf_cached( double x, const struct unur_distr *distr )
+     /*----------------------------------------------------------------------*/
+     /* evaluate logPDF at x. the result is looked up in (and stored into)   */
+     /* the cache of the distribution object.                                */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   x     ... argument for logPDF                                      */
+     /*   distr ... pointer to distribution object                           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   logPDF(x)                                                          */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_distr_cont_cache *cache = DISTR.pdfcache;
+  struct unur_distr_cont_cache_entry *entry;
+  double logfx;
+
+  entry = cache->entry + (_unur_distr_cont_cache_hash(x) & cache->mask);
+  if ((entry->has & 2u) && entry->x == x) {
+    ++(cache->n_hits);
+    return entry->logpdf;
+  }
+
+  /* not in cache */
+  ++(cache->n_misses);
+  logfx = (*(DISTR.logpdf))(x,distr);
+
+  /* store in cache */
+  if (! ((entry->has & 1u) && entry->x == x)) 
+    entry->has = 0u;
+  entry->x = x;
+  entry->logpdf = logfx;
+  entry->has |= 2u;
+
+  return logfx;
+} /* end of _unur_distr_cont_eval_logpdf_cached() */
+
 /*****************************************************************************/
 
 double
@@ -2336,7 +2555,7 @@ _unur_aux_pdf(double x, void *p)
      /*----------------------------------------------------------------------*/	
 {
   struct unur_distr *distr = p;
-  return (DISTR.pdf(x, distr));
+  return _unur_cont_PDF(x, distr);
 } 
 
 /*---------------------------------------------------------------------------*/
@@ -2346,6 +2565,7 @@ _unur_distr_cont_find_mode( struct unur_distr *distr )
      /*----------------------------------------------------------------------*/
 {
   struct unur_funct_generic pdf;  /* density function to be maximized */
+  double x[3], fx[3];             /* bracket for mode */
   double mode;
 
   /* check arguments */
@@ -2360,8 +2580,16 @@ _unur_distr_cont_find_mode( struct unur_distr *distr )
   pdf.f = _unur_aux_pdf;
   pdf.params = distr;
 
-  /* compute mode; use DISTR.center as first guess */
-  mode = _unur_util_find_max( pdf, DISTR.domain[0], DISTR.domain[1], DISTR.center );
+  /* compute mode; use DISTR.center as first guess. */
+  /* first try to find a bracket for the mode by evaluating the PDF  */
+  /* at batches of candidates. if this fails we use the slower but   */
+  /* more robust search. (the cache of the distribution object then  */
+  /* avoids most of the redundant evaluations of the PDF.)           */
+  if (_unur_util_bracket_max( pdf, DISTR.domain[0], DISTR.domain[1], DISTR.center, 
+			      x, fx ) == UNUR_SUCCESS)
+    mode = _unur_util_brent( pdf, x[0], x[2], x[1], FLT_MIN );
+  else
+    mode = _unur_util_find_max( pdf, DISTR.domain[0], DISTR.domain[1], DISTR.center );
 
   /* check result */
   if (_unur_isfinite(mode)){
@@ -2506,6 +2734,10 @@ _unur_distr_cont_debug( const struct unur_distr *distr, const char *genid )
   if (DISTR.hr) fprintf(LOG,"HR ");
   fprintf(LOG,"\n");
 
+  if (DISTR.pdfcache)
+    fprintf(LOG,"%s:\tcache for PDF values: size = %u, hits = %lu, misses = %lu\n",genid,
+	    DISTR.pdfcache->mask + 1u, DISTR.pdfcache->n_hits, DISTR.pdfcache->n_misses);
+
   if (distr->set & UNUR_DISTR_SET_MODE)
     fprintf(LOG,"%s:\tmode = %g\n",genid,DISTR.mode);
   else
@@ -597,6 +597,32 @@ double unur_distr_cont_get_pdfarea( UNUR_DISTR *distribution );
    @code{unur_errno} is set to @code{UNUR_ERR_DISTR_GET}.
 */
 
+int unur_distr_cont_set_pdfcache( UNUR_DISTR *distribution, int size );
+/* 
+   Use a cache with (at least) @var{size} entries for the values of
+   PDF and logPDF. Then redundant evaluations of these functions,
+   e.g., by the numerical search for the mode and by the setup of
+   a method, are avoided.
+   This is useful for PDFs that are expensive to evaluate (e.g.,
+   when they require numerical integration or special functions).
+   For cheap PDFs the overhead of the cache may exceed its benefit.
+   If @var{size} is 0 the cache is removed.
+
+   The cache is cleared whenever the PDF or its parameters are
+   changed.
+
+   The cache is only used during the setup of a generator.
+   At the end of unur_init() it is removed from the distribution
+   object of the generator object (and of its auxiliary
+   generators). Thus the sampling routines never access the cache,
+   which is not thread-safe.
+   (Notice that this distribution object is the given
+   @var{distribution} when unur_set_use_distr_privatecopy() is set
+   to FALSE.)
+
+   Default is no cache.
+*/
+
 /* =END */
 
 /*---------------------------------------------------------------------------*/
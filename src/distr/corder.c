@@ -38,6 +38,7 @@
 
 #include <unur_source.h>
 #include <distributions/unur_stddistr.h>
+#include <distributions/unur_distributions_source.h>
 #include "distr.h"
 #include "cont.h"
 #include "corder.h"
@@ -150,6 +151,9 @@ unur_distr_corder_new( const struct unur_distr *distr, int n, int k )
   /* there is no necessity for a function that computes the area below PDF   */
   OS.upd_area  = _unur_upd_area_corder;
 
+  /* special generator: beta variate and inversion of underlying distr. */
+  OS.init = _unur_stdgen_corder_init;
+
   /* parameters set */
   os->set = distr->set & ~UNUR_DISTR_SET_MODE; /* mode not derived from distr */
 
@@ -223,6 +227,7 @@ unur_distr_corder_set_rank( struct unur_distr *os, int n, int k )
 
   /* changelog */
   os->set &= ~UNUR_DISTR_SET_MODE; /* mode unknown */
+  _unur_distr_cont_clear_pdfcache(os);
 
   /* copy parameters */
   OS.params[0] = (double) n;
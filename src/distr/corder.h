@@ -85,6 +85,12 @@ UNUR_DISTR *unur_distr_corder_new( const UNUR_DISTR *distribution, int n, int k
 
    @emph{Important:} There is no warning when the computed area below
    the PDF of the order statistics is wrong.
+
+   If the domain of the underlying distribution @var{distribution}
+   is not changed then method CSTD (@pxref{CSTD}) can be used for
+   sampling from the order statistics. It is much faster than
+   universal methods that use the PDF of the order statistics.
+   It is also chosen by method AUTO (@pxref{AUTO}).
 */
 
 
@@ -203,30 +203,12 @@ _unur_distr_cvec_clone( const struct unur_distr *distr )
     memcpy( CLONE.mean, DISTR.mean, distr->dim * sizeof(double) );
   }
 
-  if (DISTR.covar) {
-    CLONE.covar = _unur_xmalloc( distr->dim * distr->dim * sizeof(double) );
-    memcpy( CLONE.covar, DISTR.covar, distr->dim * distr->dim * sizeof(double) );
-  }
-
-  if (DISTR.cholesky) {
-    CLONE.cholesky = _unur_xmalloc( distr->dim * distr->dim * sizeof(double) );
-    memcpy( CLONE.cholesky, DISTR.cholesky, distr->dim * distr->dim * sizeof(double) );
-  }
-
-  if (DISTR.covar_inv) {
-    CLONE.covar_inv = _unur_xmalloc( distr->dim * distr->dim * sizeof(double) );
-    memcpy( CLONE.covar_inv, DISTR.covar_inv, distr->dim * distr->dim * sizeof(double) );
-  }
-
-  if (DISTR.rankcorr) {
-    CLONE.rankcorr = _unur_xmalloc( distr->dim * distr->dim * sizeof(double) );
-    memcpy( CLONE.rankcorr, DISTR.rankcorr, distr->dim * distr->dim * sizeof(double) );
-  }
-
-  if (DISTR.rk_cholesky) {
-    CLONE.rk_cholesky = _unur_xmalloc( distr->dim * distr->dim * sizeof(double) );
-    memcpy( CLONE.rk_cholesky, DISTR.rk_cholesky, distr->dim * distr->dim * sizeof(double) );
-  }
+  /* matrices are shared with the clone (copy-on-write) */
+  CLONE.covar       = _unur_shared_ref( DISTR.covar );
+  CLONE.cholesky    = _unur_shared_ref( DISTR.cholesky );
+  CLONE.covar_inv   = _unur_shared_ref( DISTR.covar_inv );
+  CLONE.rankcorr    = _unur_shared_ref( DISTR.rankcorr );
+  CLONE.rk_cholesky = _unur_shared_ref( DISTR.rk_cholesky );
 
   if (DISTR.mode) {
     CLONE.mode = _unur_xmalloc( distr->dim * sizeof(double) );
@@ -298,11 +280,11 @@ _unur_distr_cvec_free( struct unur_distr *distr )
 
   if (DISTR.domainrect)  free(DISTR.domainrect); 
   if (DISTR.mean)        free(DISTR.mean); 
-  if (DISTR.covar)       free(DISTR.covar);
-  if (DISTR.covar_inv)   free(DISTR.covar_inv);
-  if (DISTR.cholesky)    free(DISTR.cholesky);
-  if (DISTR.rankcorr)    free(DISTR.rankcorr);
-  if (DISTR.rk_cholesky) free(DISTR.rk_cholesky);
+  _unur_shared_free(DISTR.covar);
+  _unur_shared_free(DISTR.covar_inv);
+  _unur_shared_free(DISTR.cholesky);
+  _unur_shared_free(DISTR.rankcorr);
+  _unur_shared_free(DISTR.rk_cholesky);
 
   if (DISTR.mode)        free(DISTR.mode);
   if (DISTR.center)      free(DISTR.center);
@@ -1196,10 +1178,9 @@ unur_distr_cvec_set_covar( struct unur_distr *distr, const double *covar )
 		   | UNUR_DISTR_SET_COVAR_INV );
 
   /* we have to allocate memory first */
-  if (DISTR.covar == NULL)
-    DISTR.covar = _unur_xmalloc( dim * dim * sizeof(double) );
-  if (DISTR.cholesky == NULL)
-    DISTR.cholesky = _unur_xmalloc( dim * dim * sizeof(double) );   
+  /* (or get a private copy when it is shared with a clone) */
+  DISTR.covar = _unur_shared_own( DISTR.covar, dim * dim * sizeof(double) );
+  DISTR.cholesky = _unur_shared_own( DISTR.cholesky, dim * dim * sizeof(double) );
 
   /* if covar == NULL --> use identity matrix */
   if (covar==NULL) { 
@@ -1283,8 +1264,8 @@ unur_distr_cvec_set_covar_inv( struct unur_distr *distr, const double *covar_inv
   distr->set &= ~(UNUR_DISTR_SET_COVAR_INV);
 
   /* we have to allocate memory first */
-  if (DISTR.covar_inv == NULL)
-    DISTR.covar_inv = _unur_xmalloc( dim * dim * sizeof(double) );
+  /* (or get a private copy when it is shared with a clone) */
+  DISTR.covar_inv = _unur_shared_own( DISTR.covar_inv, dim * dim * sizeof(double) );
 
   /* if covar_inv == NULL --> use identity matrix */
   if (covar_inv==NULL)
@@ -1414,11 +1395,9 @@ unur_distr_cvec_get_covar_inv ( struct unur_distr *distr )
     return NULL;
   }
 
-  /* allocate memory */
-  if (DISTR.covar_inv == NULL)
-    DISTR.covar_inv = _unur_xmalloc( dim * dim * sizeof(double) );   
-
   if ( !(distr->set & UNUR_DISTR_SET_COVAR_INV) ) {       
+      /* allocate memory (or get private copy when shared with a clone) */
+      DISTR.covar_inv = _unur_shared_own( DISTR.covar_inv, dim * dim * sizeof(double) );
       /* calculate inverse covariance matrix */
       if (_unur_matrix_invert_matrix(dim, DISTR.covar, DISTR.covar_inv, &det) != UNUR_SUCCESS) {
         _unur_error(distr->name ,UNUR_ERR_DISTR_DOMAIN,"cannot compute inverse of covariance");
@@ -1467,10 +1446,9 @@ unur_distr_cvec_set_rankcorr( struct unur_distr *distr, const double *rankcorr )
   distr->set &= ~(UNUR_DISTR_SET_RANKCORR | UNUR_DISTR_SET_RK_CHOLESKY);
 
   /* we have to allocate memory first */
-  if (DISTR.rankcorr == NULL)
-    DISTR.rankcorr = _unur_xmalloc( dim * dim * sizeof(double) );
-  if (DISTR.rk_cholesky == NULL)
-    DISTR.rk_cholesky = _unur_xmalloc( dim * dim * sizeof(double) );   
+  /* (or get a private copy when it is shared with a clone) */
+  DISTR.rankcorr = _unur_shared_own( DISTR.rankcorr, dim * dim * sizeof(double) );
+  DISTR.rk_cholesky = _unur_shared_own( DISTR.rk_cholesky, dim * dim * sizeof(double) );
 
   /* if rankcorr == NULL --> use identity matrix */
   if (rankcorr==NULL) { 
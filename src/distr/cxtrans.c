@@ -41,6 +41,7 @@
 
 #include <unur_source.h>
 #include <distributions/unur_stddistr.h>
+#include <distributions/unur_distributions_source.h>
 #include "distr.h"
 #include "cxtrans.h"
 #include "cont.h"
@@ -74,6 +75,7 @@ static int _unur_distr_cxtrans_compute_domain( struct unur_distr *cxt );
 
 /* prototypes for CDF, PDF and its derviative for transformed RV             */
 static double _unur_cdf_cxtrans( double x, const struct unur_distr *cxt );
+static double _unur_invcdf_cxtrans( double u, const struct unur_distr *cxt );
 static double _unur_pdf_cxtrans( double x, const struct unur_distr *cxt );
 static double _unur_logpdf_cxtrans( double x, const struct unur_distr *cxt );
 static double _unur_dpdf_cxtrans( double x, const struct unur_distr *cxt );
@@ -153,11 +155,15 @@ unur_distr_cxtrans_new( const struct unur_distr *distr )
 
   /* pointer to PDF, its derivative, and CDF */
   if (DISTR.cdf)     CXT.cdf = _unur_cdf_cxtrans;          /* pointer to CDF       */
+  if (DISTR.invcdf)  CXT.invcdf = _unur_invcdf_cxtrans;    /* pointer to inverse CDF */
   if (DISTR.pdf)     CXT.pdf = _unur_pdf_cxtrans;          /* pointer to PDF       */
   if (DISTR.logpdf)  CXT.logpdf = _unur_logpdf_cxtrans;    /* pointer to logPDF    */
   if (DISTR.dpdf)    CXT.dpdf = _unur_dpdf_cxtrans;        /* derivative of PDF    */
   if (DISTR.dlogpdf) CXT.dlogpdf = _unur_dlogpdf_cxtrans;  /* derivative of logPDF */
 
+  /* special generator: transform random variates of underlying distr. */
+  if (DISTR.init)    CXT.init = _unur_stdgen_cxtrans_init;
+
   /* parameters set */
   cxt->set = distr->set;
 
@@ -247,6 +253,7 @@ unur_distr_cxtrans_set_alpha( struct unur_distr *cxt, double alpha )
 
   /* changelog */
   cxt->set &= ~UNUR_DISTR_SET_MODE; /* mode unknown */
+  _unur_distr_cont_clear_pdfcache(cxt);
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -331,6 +338,7 @@ unur_distr_cxtrans_set_rescale( struct unur_distr *cxt, double mu, double sigma
 
   /* changelog */
   cxt->set &= ~UNUR_DISTR_SET_MODE; /* mode unknown */
+  _unur_distr_cont_clear_pdfcache(cxt);
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -418,6 +426,7 @@ unur_distr_cxtrans_set_logpdfpole( struct unur_distr *cxt, double logpdfpole, do
 
   /* changelog */
   cxt->set |= UNUR_DISTR_SET_GENERIC; 
+  _unur_distr_cont_clear_pdfcache(cxt);
 
   /* copy parameters */
   CXT.logPDFPOLE = logpdfpole;
@@ -546,6 +555,42 @@ int _unur_distr_cxtrans_compute_domain( struct unur_distr *cxt )
 
 /*---------------------------------------------------------------------------*/
 
+double
+_unur_distr_cxtrans_transform( double x, const struct unur_distr *cxt )
+     /*----------------------------------------------------------------------*/
+     /* transform random variate of underlying distribution:                 */
+     /*   phi((x-mu)/sigma)                                                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   x   ... random variate of underlying distribution                  */
+     /*   cxt ... pointer to distribution of transformed RV                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   transformed random variate                                         */
+     /*----------------------------------------------------------------------*/
+{
+  double alpha = CXT.ALPHA;
+  double z = (x - CXT.MU) / CXT.SIGMA;
+
+  /* exponential transformation */
+  if (_unur_isinf(alpha)==1)
+    return exp(z);
+
+  /* logarithmic transformation */
+  if (_unur_iszero(alpha))
+    return ((z>0.) ? log(z) : -UNUR_INFINITY);
+
+  /* identity */
+  if (_unur_isone(alpha))
+    return z;
+
+  /* power transformation */
+  return ((z>=0.) ? pow(z,alpha) : -pow(-z,alpha));
+
+} /* end of _unur_distr_cxtrans_transform() */
+
+/*---------------------------------------------------------------------------*/
+
 /*****************************************************************************/
 /**                                                                         **/
 /** CDF, PDF, and its derivative of transformed RV                          **/
@@ -555,6 +600,7 @@ int _unur_distr_cxtrans_compute_domain( struct unur_distr *cxt )
 /*---------------------------------------------------------------------------*/
 
 #define CDF(x)      ((*(cxt->base->data.cont.cdf))    ((x), cxt->base))
+#define invCDF(u)   ((*(cxt->base->data.cont.invcdf)) ((u), cxt->base))
 #define PDF(x)      ((*(cxt->base->data.cont.pdf))    ((x), cxt->base))
 #define logPDF(x)   ((*(cxt->base->data.cont.logpdf)) ((x), cxt->base))
 #define dPDF(x)     ((*(cxt->base->data.cont.dpdf))   ((x), cxt->base))
@@ -615,6 +661,26 @@ _unur_cdf_cxtrans( double x, const struct unur_distr *cxt )
 
 /*---------------------------------------------------------------------------*/
 
+double
+_unur_invcdf_cxtrans( double u, const struct unur_distr *cxt )
+     /*
+	invCDF(u) = phi(F^{-1}(u))
+
+	F^{-1}(.) ... inverse CDF of underlying distribution
+	phi(.)    ... transformation (monotonically increasing)
+     */
+{
+  /* check arguments */
+  CHECK_NULL( cxt, UNUR_INFINITY );
+  CHECK_NULL( cxt->base, UNUR_INFINITY );
+  CHECK_NULL( cxt->base->data.cont.invcdf, UNUR_INFINITY );
+
+  return _unur_distr_cxtrans_transform( invCDF(u), cxt );
+
+} /* end of _unur_invcdf_cxtrans() */
+
+/*---------------------------------------------------------------------------*/
+
 double
 _unur_pdf_cxtrans( double x, const struct unur_distr *cxt )
      /*
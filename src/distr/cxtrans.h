@@ -139,6 +139,14 @@ UNUR_DISTR *unur_distr_cxtrans_new( const UNUR_DISTR *distribution );
 
    Without one of these additional calls the identity transformation
    is used, i.e. the random variate is not transformed at all.
+
+   If @var{distribution} has an inverse CDF, then the inverse CDF
+   of the transformed random variate is available as well.
+   If @var{distribution} is a standard distribution, the random
+   variates drawn by its special generator can be transformed
+   directly. In both cases method CSTD (@pxref{CSTD}) can be used
+   and no hat function needs to be constructed. It is also chosen by
+   method AUTO (@pxref{AUTO}).
 */
 
 const UNUR_DISTR *unur_distr_cxtrans_get_distribution( const UNUR_DISTR *distribution );
@@ -199,11 +199,8 @@ _unur_distr_discr_clone( const struct unur_distr *distr )
   CLONE.pmftree  = (DISTR.pmftree) ? _unur_fstr_dup_tree(DISTR.pmftree) : NULL;
   CLONE.cdftree  = (DISTR.cdftree) ? _unur_fstr_dup_tree(DISTR.cdftree) : NULL;
 
-  /* copy probability vector into generator object (when there is one) */
-  if (DISTR.pv) {
-    CLONE.pv = _unur_xmalloc( DISTR.n_pv * sizeof(double) );
-    memcpy( CLONE.pv, DISTR.pv, DISTR.n_pv * sizeof(double) );
-  }
+  /* probability vector is shared with the clone (copy-on-write) */
+  CLONE.pv = _unur_shared_ref( DISTR.pv );
 
   /* copy user name for distribution */
   if (distr->name_str) {
@@ -237,7 +234,7 @@ _unur_distr_discr_free( struct unur_distr *distr )
   if (DISTR.pmftree)  _unur_fstr_free(DISTR.pmftree);
   if (DISTR.cdftree)  _unur_fstr_free(DISTR.cdftree);
 
-  if (DISTR.pv) free( DISTR.pv );
+  _unur_shared_free( DISTR.pv );
 
   /* user name for distribution */
   if (distr->name_str) free(distr->name_str);
@@ -292,7 +289,8 @@ unur_distr_discr_set_pv( struct unur_distr *distr, const double *pv, int n_pv )
      (it is cheaper to do it when unur_init() is called */
 
   /* allocate memory for probability vector */
-  DISTR.pv = _unur_xrealloc( DISTR.pv, n_pv * sizeof(double) );
+  /* (a new one is allocated when it is shared with a clone) */
+  DISTR.pv = _unur_xrealloc_shared( DISTR.pv, n_pv * sizeof(double) );
   if (!DISTR.pv) return UNUR_ERR_MALLOC;
 
   /* copy probability vector */
@@ -339,7 +337,7 @@ unur_distr_discr_make_pv( struct unur_distr *distr )
 
   /* if there exists a PV, it has to be removed */
   if (DISTR.pv != NULL) {
-    free(DISTR.pv); DISTR.n_pv = 0;
+    _unur_shared_free(DISTR.pv); DISTR.pv = NULL; DISTR.n_pv = 0;
   }
 
   /* compute PV */
@@ -348,7 +346,7 @@ unur_distr_discr_make_pv( struct unur_distr *distr )
 
     /* first case: bounded domain */
     n_pv = DISTR.domain[1] - DISTR.domain[0] + 1;
-    pv = _unur_xmalloc( n_pv * sizeof(double) );
+    pv = _unur_xmalloc_shared( n_pv * sizeof(double) );
     if (DISTR.pmf) {
       for (i=0; i<n_pv; i++)
 	pv[i] = _unur_discr_PMF(DISTR.domain[0]+i,distr);
@@ -394,7 +392,7 @@ unur_distr_discr_make_pv( struct unur_distr *distr )
 
     /* compute PV */
     for (n_alloc = size_alloc; n_alloc <= max_alloc; n_alloc += size_alloc) {
-      pv = _unur_xrealloc( pv, n_alloc * sizeof(double) );
+      pv = _unur_xrealloc_shared( pv, n_alloc * sizeof(double) );
 
       if (DISTR.pmf) {
 	for (i=0; i<size_alloc; i++) {
@@ -537,7 +535,7 @@ unur_distr_discr_set_pmf( struct unur_distr *distr, UNUR_FUNCT_DISCR *pmf )
   /* it is not possible to set both a PMF and a PV */
   if (DISTR.pv != NULL) {
     _unur_warning(distr->name,UNUR_ERR_DISTR_SET,"delete exisiting PV");
-    free(DISTR.pv); DISTR.n_pv = 0;
+    _unur_shared_free(DISTR.pv); DISTR.pv = NULL; DISTR.n_pv = 0;
   }
 
   /* we do not allow overwriting a PMF */
@@ -579,7 +577,7 @@ unur_distr_discr_set_cdf( struct unur_distr *distr, UNUR_FUNCT_DISCR *cdf )
   /* it is not possible to set both a CDF and a PV */
   if (DISTR.pv != NULL) {
     _unur_warning(distr->name,UNUR_ERR_DISTR_SET,"delete exisiting PV");
-    free(DISTR.pv); DISTR.n_pv = 0;
+    _unur_shared_free(DISTR.pv); DISTR.pv = NULL; DISTR.n_pv = 0;
   }
 
   /* we do not allow overwriting a CDF */
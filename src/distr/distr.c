@@ -42,6 +42,7 @@
 #include <distributions/unur_stddistr.h>
 #include "distr.h"
 #include "distr_source.h"
+#include <parser/functparser_source.h>
 
 
 /*---------------------------------------------------------------------------*/
@@ -362,6 +363,104 @@ unur_distr_clone( const struct unur_distr *distr )
 
 /*---------------------------------------------------------------------------*/
 
+size_t
+_unur_distr_memsize( const struct unur_distr *distr )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes occupied by distribution object              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   distr ... pointer to distribution object                           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   size of distribution object in bytes                               */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size;
+  int i, dim;
+
+  if (distr == NULL) return 0;
+
+  size = sizeof(struct unur_distr);
+  if (distr->name_str) size += strlen(distr->name_str) + 1;
+
+  dim = distr->dim;
+
+  switch (distr->type) {
+  case UNUR_DISTR_CONT:
+    for (i=0; i<UNUR_DISTR_MAXPARAMS; i++)
+      if (distr->data.cont.param_vecs[i])
+	size += distr->data.cont.n_param_vec[i] * sizeof(double);
+    size += _unur_fstr_tree_memsize(distr->data.cont.pdftree);
+    size += _unur_fstr_tree_memsize(distr->data.cont.dpdftree);
+    size += _unur_fstr_tree_memsize(distr->data.cont.logpdftree);
+    size += _unur_fstr_tree_memsize(distr->data.cont.dlogpdftree);
+    size += _unur_fstr_tree_memsize(distr->data.cont.cdftree);
+    size += _unur_fstr_tree_memsize(distr->data.cont.logcdftree);
+    size += _unur_fstr_tree_memsize(distr->data.cont.hrtree);
+    if (distr->data.cont.pdfcache)
+      size += ( sizeof(struct unur_distr_cont_cache)
+		+ (distr->data.cont.pdfcache->mask + 1) * sizeof(struct unur_distr_cont_cache_entry) );
+    break;
+
+  case UNUR_DISTR_CVEC:
+    if (distr->data.cvec.mean)        size += dim * sizeof(double);
+    /* matrices may be shared with clones (copy-on-write) */
+    size += _unur_shared_memsize(distr->data.cvec.covar);
+    size += _unur_shared_memsize(distr->data.cvec.cholesky);
+    size += _unur_shared_memsize(distr->data.cvec.covar_inv);
+    size += _unur_shared_memsize(distr->data.cvec.rankcorr);
+    size += _unur_shared_memsize(distr->data.cvec.rk_cholesky);
+    if (distr->data.cvec.mode)        size += dim * sizeof(double);
+    if (distr->data.cvec.center)      size += dim * sizeof(double);
+    if (distr->data.cvec.domainrect)  size += 2 * dim * sizeof(double);
+    for (i=0; i<UNUR_DISTR_MAXPARAMS; i++)
+      if (distr->data.cvec.param_vecs[i])
+	size += distr->data.cvec.n_param_vec[i] * sizeof(double);
+    if (distr->data.cvec.marginals) {
+      size += dim * sizeof(struct unur_distr *);
+      /* all entries may point to the same object */
+      /* (see _unur_distr_cvec_marginals_clone()) */
+      for (i=0; i<dim; i++)
+	if (i==0 || distr->data.cvec.marginals[i] != distr->data.cvec.marginals[0])
+	  size += _unur_distr_memsize(distr->data.cvec.marginals[i]);
+    }
+    break;
+
+  case UNUR_DISTR_DISCR:
+    /* probability vector may be shared with clones (copy-on-write) */
+    size += _unur_shared_memsize(distr->data.discr.pv);
+    size += _unur_fstr_tree_memsize(distr->data.discr.pmftree);
+    size += _unur_fstr_tree_memsize(distr->data.discr.cdftree);
+    break;
+
+  case UNUR_DISTR_CEMP:
+    /* a sample owned by the caller is not counted */
+    if (distr->data.cemp.sample && !distr->data.cemp.sample_is_ref)
+      size += distr->data.cemp.n_sample * sizeof(double);
+    if (distr->data.cemp.hist_prob)
+      size += distr->data.cemp.n_hist * sizeof(double);
+    if (distr->data.cemp.hist_bins)
+      size += (distr->data.cemp.n_hist + 1) * sizeof(double);
+    break;
+
+  case UNUR_DISTR_CVEMP:
+    if (distr->data.cvemp.sample)
+      size += distr->data.cvemp.n_sample * dim * sizeof(double);
+    break;
+
+  default:
+    break;
+  }
+
+  /* underlying distribution */
+  if (distr->base)
+    size += _unur_distr_memsize(distr->base);
+
+  return size;
+} /* end of _unur_distr_memsize() */
+
+/*---------------------------------------------------------------------------*/
+
 int
 unur_distr_set_extobj( struct unur_distr *distr, const void *extobj )
      /*----------------------------------------------------------------------*/
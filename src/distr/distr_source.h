@@ -82,9 +82,19 @@
 /* call PDFs and CDFs                                                        */
 /* (no checking for NULL pointer !)                                          */
 
-#define _unur_cont_PDF(x,distr)     ((*((distr)->data.cont.pdf)) ((x),(distr)))
+/* PDF and logPDF are looked up in the cache of the distribution object     */
+/* if it has one (see unur_distr_cont_set_pdfcache()).                       */
+/* The cache only exists during setup: unur_init() removes it from the      */
+/* distribution objects of the generator.                                    */
+#define _unur_cont_PDF(x,distr) \
+   ( ((distr)->data.cont.pdfcache) \
+     ? _unur_distr_cont_eval_pdf_cached((x),(distr)) \
+     : (*((distr)->data.cont.pdf)) ((x),(distr)) )
 #define _unur_cont_dPDF(x,distr)    ((*((distr)->data.cont.dpdf))((x),(distr)))
-#define _unur_cont_logPDF(x,distr)  ((*((distr)->data.cont.logpdf)) ((x),(distr)))
+#define _unur_cont_logPDF(x,distr) \
+   ( ((distr)->data.cont.pdfcache) \
+     ? _unur_distr_cont_eval_logpdf_cached((x),(distr)) \
+     : (*((distr)->data.cont.logpdf)) ((x),(distr)) )
 #define _unur_cont_dlogPDF(x,distr) ((*((distr)->data.cont.dlogpdf))((x),(distr)))
 #define _unur_cont_CDF(x,distr)     ((*((distr)->data.cont.cdf)) ((x),(distr)))
 #define _unur_cont_logCDF(x,distr)  ((*((distr)->data.cont.logcdf)) ((x),(distr)))
@@ -115,6 +125,16 @@ double _unur_cvec_pdlogPDF(const double *x, int coord, struct unur_distr *distr)
 #define _unur_cont_have_logPDF(distr)  (((distr)->data.cont.logpdf==NULL)?FALSE:TRUE)
 #define _unur_cont_have_dlogPDF(distr) (((distr)->data.cont.dlogpdf==NULL)?FALSE:TRUE)
 
+/*---------------------------------------------------------------------------*/
+/* cache for PDF and logPDF values                                           */
+
+double _unur_distr_cont_eval_pdf_cached( double x, const struct unur_distr *distr );
+double _unur_distr_cont_eval_logpdf_cached( double x, const struct unur_distr *distr );
+/* evaluate PDF and logPDF, resp., and store result in cache                 */
+
+void _unur_distr_cont_clear_pdfcache( struct unur_distr *distr );
+/* remove all entries from cache (when PDF or its parameters are changed)    */
+
 /*---------------------------------------------------------------------------*/
 /* wrapper functions for PDF when only logPDF is given                       */
 
@@ -143,6 +163,18 @@ struct unur_distr *_unur_distr_discr_clone( const struct unur_distr *distr );
 
 #define _unur_distr_clone(distr)    ((distr)->clone(distr))
 
+/*---------------------------------------------------------------------------*/
+/* memory used by distribution object                                        */
+
+size_t _unur_distr_memsize( const struct unur_distr *distr );
+/* number of bytes occupied by distribution object (including its arrays)    */
+
+/*---------------------------------------------------------------------------*/
+/* transformed random variables                                              */
+
+double _unur_distr_cxtrans_transform( double x, const struct unur_distr *cxt );
+/* transform random variate of underlying distribution: phi((x-mu)/sigma)   */
+
 /*---------------------------------------------------------------------------*/
 /* destroy distribution object                                               */
 #define _unur_distr_free(distr)    do {if (distr) (distr)->destroy(distr);} while(0)
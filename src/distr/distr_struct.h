@@ -34,6 +34,23 @@
  *                                                                           *
  *****************************************************************************/
 
+/*---------------------------------------------------------------------------*/
+/* cache for evaluations of PDF and logPDF of univariate continuous distr.   */
+
+struct unur_distr_cont_cache_entry {
+  double x;                     /* argument                                  */
+  double pdf;                   /* PDF at x                                  */
+  double logpdf;                /* logPDF at x                               */
+  unsigned has;                 /* which values are stored (bit field)       */
+};
+
+struct unur_distr_cont_cache {
+  struct unur_distr_cont_cache_entry *entry; /* table of entries (direct mapped) */
+  unsigned mask;                /* size of table - 1 (size is power of 2)    */
+  unsigned long n_hits;         /* number of cache hits                      */
+  unsigned long n_misses;       /* number of cache misses                    */
+};
+
 /*---------------------------------------------------------------------------*/
 /* define object for univariate continuous distribution                      */
 
@@ -79,6 +96,8 @@ struct unur_distr_cont {
 
   int  (*init)(struct unur_par *par,struct unur_gen *gen);
                                 /* pointer to special init routine           */
+
+  struct unur_distr_cont_cache *pdfcache; /* cache for PDF and logPDF values */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -181,6 +200,7 @@ struct unur_distr_cemp {
   /* raw data */
   int     n_sample;             /* length of sample probability vector       */
   double *sample;               /* pointer to sample                         */
+  int     sample_is_ref;        /* whether sample is owned by caller         */
   /* histogram */
   int     n_hist;               /* number of bins in histogram               */
   double *hist_prob;            /* probabilities for bins                    */
@@ -0,0 +1,270 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE:      c_corder_gen.c                                               *
+ *                                                                           *
+ *   Special generators for order statistics                                 *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2010 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include <unur_source.h>
+#include <distr/cont.h>
+#include <distr/distr_source.h>
+#include <methods/cstd.h>
+#include <methods/cstd_struct.h>
+#include <methods/pinv.h>
+#include <methods/x_gen.h>
+#include <methods/x_gen_source.h>
+#include "unur_distributions_source.h"
+#include "unur_distributions.h"
+
+/*---------------------------------------------------------------------------*/
+/* init routines for special generators                                      */
+
+inline static int corder_binv_init( struct unur_gen *gen );
+
+/*---------------------------------------------------------------------------*/
+/* abbreviations */
+
+#define PAR       ((struct unur_cstd_par*)par->datap) /* data for parameter object */
+#define GEN       ((struct unur_cstd_gen*)gen->datap) /* data for generator object */
+#define DISTR     gen->distr->data.cont /* data for distribution in generator object */
+
+#define os_n  (DISTR.params[0])   /* sample size */
+#define os_k  (DISTR.params[1])   /* rank */
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************/
+/**                                                                         **/
+/**  Inititialize                                                           **/
+/**                                                                         **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_stdgen_corder_init( struct unur_par *par, struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* initialize special generator for order statistics                    */
+     /* if gen == NULL then only check existance of variant.                 */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par ... pointer to parameter for building generator object         */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* one of par and gen must not be the NULL pointer */
+  switch ((par) ? par->variant : gen->variant) {
+
+  case 0:  /* DEFAULT */
+  case 1:  /* Beta variate and inversion of underlying distribution */
+    { /* check underlying distribution */
+      struct unur_distr *base = (par) ? par->distr->base : gen->distr->base;
+      if (base == NULL ||
+	  (base->data.cont.invcdf == NULL &&
+	   base->data.cont.pdf == NULL && base->data.cont.cdf == NULL)) {
+	_unur_error(NULL,UNUR_ERR_GEN_CONDITION,"inverse CDF, PDF or CDF of underlying distribution required");
+	return UNUR_ERR_GEN_CONDITION;
+      }
+    }
+
+    _unur_cstd_set_sampling_routine(gen, _unur_stdgen_sample_corder_binv );
+    return corder_binv_init( gen );
+
+  default: /* no such generator */
+    return UNUR_FAILURE;
+  }
+
+} /* end of _unur_stdgen_corder_init() */
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************/
+/**                                                                         **/
+/**  Special generators                                                     **/
+/**                                                                         **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************
+ *                                                                           *
+ * Order Statistics: Beta variate and inversion                              *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ * FUNCTION:   - samples a random number from the distribution of the k-th   *
+ *               order statistics of a sample of size n.                     *
+ *                                                                           *
+ * The k-th order statistics of a sample of size n from a uniform            *
+ * distribution is beta(k,n-k+1) distributed. Thus we can sample from the    *
+ * order statistics of a continuous distribution with CDF F by means of      *
+ * X = F^{-1}(B) where B ~ beta(k,n-k+1).                                    *
+ * The inverse CDF of the underlying distribution is used when available.    *
+ * Otherwise it is approximated by means of method PINV.                     *
+ *                                                                           *
+ * REFERENCE : - L. Devroye (1986): Non-Uniform Random Variate Generation,   *
+ *               Springer-Verlag, New York; ch. V.3.                         *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#define BETA    gen->gen_aux           /* generator for beta variates        */
+#define INVGEN  gen->gen_aux_list[0]   /* generator for inverse CDF of base  */
+#define BASE    gen->distr->base->data.cont  /* underlying distribution      */
+/*---------------------------------------------------------------------------*/
+
+inline static int
+corder_binv_init( struct unur_gen *gen )
+{
+  double beta_params[2];
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_ERR_COOKIE);
+
+  /* -X- setup code -X- */
+
+  /* parameters of beta distribution */
+  beta_params[0] = os_k;
+  beta_params[1] = os_n - os_k + 1.;
+
+  /* make a beta variate generator (use default special generator) */
+  if (BETA==NULL) {
+    struct unur_distr *distr = unur_distr_beta(beta_params,2);
+    struct unur_par *par = unur_cstd_new( distr );
+    BETA = (par) ? _unur_init(par) : NULL;
+    /* we do not need the distribution object any more */
+    _unur_distr_free( distr );
+    _unur_check_NULL( NULL, BETA, UNUR_ERR_NULL );
+    /* need same uniform random number generator as order statistics */
+    BETA->urng = gen->urng;
+    /* copy debugging flags */
+    BETA->debug = gen->debug;
+  }
+  else {
+    /* we are in the re-init mode
+       --> n and k may have been changed */
+    if (unur_distr_cont_set_pdfparams(BETA->distr,beta_params,2) != UNUR_SUCCESS ||
+	unur_reinit(BETA) != UNUR_SUCCESS) {
+      _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"cannot reinit beta generator");
+      return UNUR_ERR_GEN_DATA;
+    }
+  }
+
+  /* inverse CDF of underlying distribution: */
+  /* we use the given one if the domain has not been changed */
+  /* and make a PINV generator otherwise.                    */
+  if ( ! (BASE.invcdf && (gen->distr->base->set & UNUR_DISTR_SET_STDDOMAIN)) &&
+       gen->n_gen_aux_list == 0 ) {
+    struct unur_par *par = unur_pinv_new( gen->distr->base );
+    struct unur_gen *invgen = (par) ? _unur_init(par) : NULL;
+    if (invgen == NULL) {
+      _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"cannot compute inverse CDF of underlying distribution");
+      return UNUR_ERR_GEN_DATA;
+    }
+    invgen->urng = gen->urng;
+    invgen->debug = gen->debug;
+    gen->gen_aux_list = _unur_xmalloc( sizeof(struct unur_gen *) );
+    gen->n_gen_aux_list = 1;
+    INVGEN = invgen;
+  }
+
+  /* routine for sampling arrays */
+  gen->sample_array.cont = _unur_stdgen_sample_corder_binv_array;
+
+  /* -X- end of setup code -X- */
+
+  return UNUR_SUCCESS;
+
+} /* end of corder_binv_init() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_stdgen_sample_corder_binv( struct unur_gen *gen )
+{
+  /* -X- generator code -X- */
+  double B;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_INFINITY);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_INFINITY);
+
+  B = _unur_sample_cont(BETA);
+
+  return ( (gen->n_gen_aux_list)
+	   ? unur_pinv_eval_approxinvcdf(INVGEN,B)
+	   : BASE.invcdf(B,gen->distr->base) );
+
+  /* -X- end of generator code -X- */
+
+} /* end of _unur_stdgen_sample_corder_binv() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_stdgen_sample_corder_binv_array( struct unur_gen *gen, double *X, int n )
+     /*----------------------------------------------------------------------*/
+     /* sample array of random variates: first draw all beta variates and    */
+     /* then evaluate the inverse CDF of the underlying distribution.        */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  int rcode;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_ERR_COOKIE);
+
+  rcode = unur_sample_cont_array(BETA,X,n);
+  if (rcode != UNUR_SUCCESS) return rcode;
+
+  if (gen->n_gen_aux_list) {
+    for (i=0; i<n; i++)
+      X[i] = unur_pinv_eval_approxinvcdf(INVGEN,X[i]);
+  }
+  else {
+    for (i=0; i<n; i++)
+      X[i] = BASE.invcdf(X[i],gen->distr->base);
+  }
+
+  return UNUR_SUCCESS;
+
+} /* end of _unur_stdgen_sample_corder_binv_array() */
+
+/*---------------------------------------------------------------------------*/
+#undef BETA
+#undef INVGEN
+#undef BASE
+/*---------------------------------------------------------------------------*/
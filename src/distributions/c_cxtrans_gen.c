@@ -0,0 +1,218 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE:      c_cxtrans_gen.c                                              *
+ *                                                                           *
+ *   Special generators for transformed random variables                     *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2010 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include <unur_source.h>
+#include <distr/distr_source.h>
+#include <methods/cstd.h>
+#include <methods/cstd_struct.h>
+#include <methods/x_gen.h>
+#include <methods/x_gen_source.h>
+#include "unur_distributions_source.h"
+
+/*---------------------------------------------------------------------------*/
+/* init routines for special generators                                      */
+
+inline static int cxtrans_trf_init( struct unur_gen *gen );
+
+/*---------------------------------------------------------------------------*/
+/* abbreviations */
+
+#define PAR       ((struct unur_cstd_par*)par->datap) /* data for parameter object */
+#define GEN       ((struct unur_cstd_gen*)gen->datap) /* data for generator object */
+#define DISTR     gen->distr->data.cont /* data for distribution in generator object */
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************/
+/**                                                                         **/
+/**  Inititialize                                                           **/
+/**                                                                         **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_stdgen_cxtrans_init( struct unur_par *par, struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* initialize special generator for transformed random variables        */
+     /* if gen == NULL then only check existance of variant.                 */
+     /*                                                                      */
+     /* The variants are those of the underlying distribution.               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par ... pointer to parameter for building generator object         */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  const struct unur_distr *distr = (par) ? par->distr : gen->distr;
+  unsigned variant = (par) ? par->variant : gen->variant;
+
+  /* inversion method uses inverse CDF of transformed distribution */
+  if (variant == UNUR_STDGEN_INVERSION)
+    return UNUR_FAILURE;
+
+  /* domain must not be changed and special generator for */
+  /* underlying distribution is required                   */
+  if ( !(distr->set & UNUR_DISTR_SET_STDDOMAIN) ||
+       distr->base == NULL || distr->base->data.cont.init == NULL )
+    return UNUR_FAILURE;
+
+  if (gen == NULL) {
+    /* test existence of variant for underlying distribution */
+    struct unur_par *bpar = unur_cstd_new(distr->base);
+    int rcode;
+    if (bpar == NULL) return UNUR_FAILURE;
+    bpar->variant = variant;
+    rcode = distr->base->data.cont.init(bpar,NULL);
+    _unur_par_free(bpar);
+    return rcode;
+  }
+
+  _unur_cstd_set_sampling_routine(gen, _unur_stdgen_sample_cxtrans_trf );
+  return cxtrans_trf_init( gen );
+
+} /* end of _unur_stdgen_cxtrans_init() */
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************/
+/**                                                                         **/
+/**  Special generators                                                     **/
+/**                                                                         **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************
+ *                                                                           *
+ * Transformed random variables: transform random variates                   *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ * FUNCTION:   - samples a random number from the distribution of the        *
+ *               transformed random variable phi((X-mu)/sigma).              *
+ *                                                                           *
+ * The random variate X is drawn by the special generator for the            *
+ * underlying distribution. As phi is monotone, we neither need the PDF      *
+ * of the transformed random variable nor a hat function.                    *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#define BASEGEN  gen->gen_aux   /* generator for underlying distribution     */
+/*---------------------------------------------------------------------------*/
+
+inline static int
+cxtrans_trf_init( struct unur_gen *gen )
+{
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_ERR_COOKIE);
+
+  /* -X- setup code -X- */
+
+  /* make generator for underlying distribution (same variant) */
+  if (BASEGEN==NULL) {
+    struct unur_par *par = unur_cstd_new( gen->distr->base );
+    if (par) par->variant = gen->variant;
+    BASEGEN = (par) ? _unur_init(par) : NULL;
+    _unur_check_NULL( NULL, BASEGEN, UNUR_ERR_NULL );
+    /* need same uniform random number generator */
+    BASEGEN->urng = gen->urng;
+    /* copy debugging flags */
+    BASEGEN->debug = gen->debug;
+  }
+  /* else we are in the re-init mode: only the parameters of the
+     transformation may have been changed.
+     --> there is no necessity to make the generator object again */
+
+  /* routine for sampling arrays */
+  gen->sample_array.cont = _unur_stdgen_sample_cxtrans_trf_array;
+
+  /* -X- end of setup code -X- */
+
+  return UNUR_SUCCESS;
+
+} /* end of cxtrans_trf_init() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_stdgen_sample_cxtrans_trf( struct unur_gen *gen )
+{
+  /* -X- generator code -X- */
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_INFINITY);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_INFINITY);
+
+  return _unur_distr_cxtrans_transform( _unur_sample_cont(BASEGEN), gen->distr );
+
+  /* -X- end of generator code -X- */
+
+} /* end of _unur_stdgen_sample_cxtrans_trf() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_stdgen_sample_cxtrans_trf_array( struct unur_gen *gen, double *X, int n )
+     /*----------------------------------------------------------------------*/
+     /* sample array of random variates: first draw all random variates of   */
+     /* underlying distribution and then transform them.                     */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  int rcode;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_ERR_COOKIE);
+
+  rcode = unur_sample_cont_array(BASEGEN,X,n);
+  if (rcode != UNUR_SUCCESS) return rcode;
+
+  for (i=0; i<n; i++)
+    X[i] = _unur_distr_cxtrans_transform( X[i], gen->distr );
+
+  return UNUR_SUCCESS;
+
+} /* end of _unur_stdgen_sample_cxtrans_trf_array() */
+
+/*---------------------------------------------------------------------------*/
+#undef BASEGEN
+/*---------------------------------------------------------------------------*/
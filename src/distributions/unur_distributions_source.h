@@ -275,6 +275,28 @@ double _unur_stdgen_sample_normal_acr( UNUR_GEN *generator );
 double _unur_stdgen_sample_normal_sum( UNUR_GEN *generator );
 
 
+/*---------------------------------------------------------------------------*/
+/* Order statistics  [Devroye; ch.V.3]                                       */
+
+/* initialize special generator                                              */
+int _unur_stdgen_corder_init( UNUR_PAR *parameters, UNUR_GEN *generator );
+
+/* Beta variate and inversion of underlying distribution                     */
+double _unur_stdgen_sample_corder_binv( UNUR_GEN *generator );
+int _unur_stdgen_sample_corder_binv_array( UNUR_GEN *generator, double *X, int n );
+
+
+/*---------------------------------------------------------------------------*/
+/* Transformed random variables (CXTRANS)                                    */
+
+/* initialize special generator                                              */
+int _unur_stdgen_cxtrans_init( UNUR_PAR *parameters, UNUR_GEN *generator );
+
+/* Transformation of random variates of underlying distribution              */
+double _unur_stdgen_sample_cxtrans_trf( UNUR_GEN *generator );
+int _unur_stdgen_sample_cxtrans_trf_array( UNUR_GEN *generator, double *X, int n );
+
+
 /*---------------------------------------------------------------------------*/
 /* Pareto distribution (of first kind)  [2; ch.20, p.574]                   */
 
@@ -186,6 +186,11 @@ static void _unur_arou_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_arou_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_arou_sample( struct unur_gen *gen );
 static double _unur_arou_sample_check( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
@@ -789,6 +794,7 @@ unur_arou_chg_verify( struct unur_gen *gen, int verify )
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, AROU, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* we must not change this switch when sampling has been disabled by
      using a pointer to the error producing routine                          */
@@ -1011,6 +1017,7 @@ _unur_arou_create( struct unur_par *par )
   SAMPLE = _unur_arou_getSAMPLE(gen);
   gen->destroy = _unur_arou_free;
   gen->clone = _unur_arou_clone;
+  gen->memsize = _unur_arou_memsize;
 
   /* set all pointers to NULL */
   GEN->seg         = NULL;
@@ -1163,6 +1170,35 @@ _unur_arou_free( struct unur_gen *gen )
 
 } /* end of _unur_arou_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_arou_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+  struct unur_arou_segment *seg;
+  int max_guide_size;
+
+  /* linked list of segments */
+  for (seg = GEN->seg; seg != NULL; seg = seg->next)
+    size += sizeof(struct unur_arou_segment);
+
+  /* guide table (allocated for the maximal number of segments) */
+  if (GEN->guide) {
+    max_guide_size = (GEN->guide_factor > 0.) ? ((int)(GEN->max_segs * GEN->guide_factor)) : 1;
+    if (max_guide_size <= 0) max_guide_size = 1;
+    size += max_guide_size * sizeof(struct unur_arou_segment*);
+  }
+
+  return size;
+} /* end of _unur_arou_memsize() */
+
 /*****************************************************************************/
 
 double
@@ -1192,8 +1228,10 @@ _unur_arou_sample( struct unur_gen *gen )
 
   /* main URNG */
   urng = gen->urng;
+  _unur_stats_count(gen,sample);
 
   while (1) {
+    _unur_stats_count(gen,trial);
 
     /* sample from U(0,1) */
     R = _unur_call_urng(urng);
@@ -1203,6 +1241,7 @@ _unur_arou_sample( struct unur_gen *gen )
     R *= GEN->Atotal;
     while (seg->Acum < R) {
       seg = seg->next;
+      _unur_stats_count(gen,search);
     }
     COOKIE_CHECK(seg,CK_AROU_SEG,UNUR_INFINITY);
 
@@ -1214,6 +1253,7 @@ _unur_arou_sample( struct unur_gen *gen )
       /* inside */
       /* reuse of random number.                       */
       /* We can avoid R = (seg->Ain - R) / seg->Ain    */
+      _unur_stats_count(gen,squeeze);
       return( ( seg->Ain * seg->rtp[0] + R * (seg->ltp[0] - seg->rtp[0]) ) /
 	      ( seg->Ain * seg->rtp[1] + R * (seg->ltp[1] - seg->rtp[1]) ) );
     }
@@ -1237,6 +1277,7 @@ _unur_arou_sample( struct unur_gen *gen )
       x = (seg->ltp[0]*R1 + seg->rtp[0]*R2 + seg->mid[0]*R3) / u;
 
       /* density at x */
+      _unur_stats_count(gen,pdf);
       fx = PDF(x);
 
       /* being outside the squeeze is bad. improve the situation! */
@@ -99,6 +99,7 @@
 #define ARS_SET_RETRY_NCPOINTS 0x010u
 #define ARS_SET_MAX_IVS        0x020u
 #define ARS_SET_MAX_ITER       0x040u   /* maximum number of iterations      */
+#define ARS_SET_WARMSTART      0x080u   /* retain cpoints for reinit         */
 
 /*---------------------------------------------------------------------------*/
 
@@ -116,6 +117,11 @@ static int _unur_ars_reinit( struct unur_gen *gen );
 /* Reinitialize generator.                                                   */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_ars_reinit_warm( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* Re-initialize generator by reusing construction points of current hat.    */
+/*---------------------------------------------------------------------------*/
+
 static struct unur_gen *_unur_ars_create( struct unur_par *par );
 /*---------------------------------------------------------------------------*/
 /* create new (almost empty) generator object.                               */
@@ -131,6 +137,11 @@ static void _unur_ars_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_ars_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_ars_sample( struct unur_gen *generator );
 static double _unur_ars_sample_check( struct unur_gen *generator );
 /*---------------------------------------------------------------------------*/
@@ -327,6 +338,7 @@ unur_ars_new( const struct unur_distr* distr )
   PAR->percentiles         = NULL;   /* pointer to array of percentiles      */
   PAR->n_percentiles       = 2;      /* number of percentiles                */
   PAR->retry_ncpoints      = 30;     /* number of cpoints for second trial of reinit */
+  PAR->warm_ncpoints       = 0;      /* no warm start for reinit             */
   PAR->max_ivs             = 200;    /* maximum number of intervals          */
   PAR->max_iter            = 10000;  /* maximum number of iterations         */
  
@@ -519,6 +531,7 @@ unur_ars_chg_reinit_percentiles( struct unur_gen *gen, int n_percentiles, const
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, ARS, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* check given percentiles */
   if (n_percentiles < 2 ) {
@@ -626,6 +639,7 @@ unur_ars_chg_reinit_ncpoints( struct unur_gen *gen, int ncpoints )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, ARS, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* check number */
   if (ncpoints < 10 ) {
@@ -645,6 +659,43 @@ unur_ars_chg_reinit_ncpoints( struct unur_gen *gen, int ncpoints )
 
 /*---------------------------------------------------------------------------*/
 
+int
+unur_ars_set_reinit_warmstart( struct unur_par *par, int ncpoints )
+     /*----------------------------------------------------------------------*/
+     /* set maximal number of construction points of the current hat         */
+     /* that are retained for reinit (warm start)                            */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par      ... pointer to parameter for building generator           */
+     /*   ncpoints ... number of construction points (0 disables warm start) */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, ARS );
+
+  /* check number */
+  if (ncpoints < 0 || ncpoints == 1) {
+    _unur_warning(GENTYPE,UNUR_ERR_PAR_SET,"number of construction points < 2");
+    return UNUR_ERR_PAR_SET;
+  }
+
+  /* store date */
+  PAR->warm_ncpoints = ncpoints;
+
+  /* changelog */
+  par->set |= ARS_SET_WARMSTART; 
+
+  return UNUR_SUCCESS;
+
+} /* end of unur_ars_set_reinit_warmstart() */
+
+/*---------------------------------------------------------------------------*/
+
 int
 unur_ars_set_max_iter( struct unur_par *par, int max_iter )
      /*----------------------------------------------------------------------*/
@@ -732,6 +783,7 @@ unur_ars_chg_verify( struct unur_gen *gen, int verify )
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, ARS, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* we must not change this switch when sampling has been disabled by
      using a pointer to the error producing routine                          */
@@ -912,8 +964,18 @@ _unur_ars_reinit( struct unur_gen *gen )
   /* first trial */
   n_trials = 1;
 
+  /* try to reuse construction points of current hat (warm start).  */
+  /* we do not reuse the points of a hat where splitting an interval */
+  /* has shown that the PDF is not log-concave.                      */
+  if (GEN->warm_ncpoints > 0 && !GEN->not_logconcave) {
+    if (_unur_ars_reinit_warm(gen) == UNUR_SUCCESS)
+      n_trials = 0;   /* no further trials required */
+    /* otherwise the old hat has been destroyed. */
+    /* so we have to use the given starting points. */
+  }
+
   /* which construction points should be used ? */
-  if (gen->set & ARS_SET_N_PERCENTILES) {
+  else if (gen->set & ARS_SET_N_PERCENTILES) {
     if (GEN->starting_cpoints==NULL || (GEN->n_starting_cpoints != GEN->n_percentiles)) {
       GEN->n_starting_cpoints = GEN->n_percentiles;
       GEN->starting_cpoints = _unur_xrealloc( GEN->starting_cpoints, GEN->n_percentiles * sizeof(double));
@@ -936,7 +998,7 @@ _unur_ars_reinit( struct unur_gen *gen )
   bak_n_cpoints = GEN->n_starting_cpoints;
   bak_cpoints = GEN->starting_cpoints;
 
-  for (;; ++n_trials) {
+  for ( ; n_trials > 0; ++n_trials) {
     /* free linked list of intervals */
     for (iv = GEN->iv; iv != NULL; iv = next) {
       next = iv->next;
@@ -996,6 +1058,9 @@ _unur_ars_reinit( struct unur_gen *gen )
     GEN->starting_cpoints = bak_cpoints;
   }
 
+  /* new hat: no violation of log-concavity found yet */
+  GEN->not_logconcave = FALSE;
+
   /* (re)set sampling routine */
   SAMPLE = _unur_ars_getSAMPLE(gen);
 
@@ -1010,6 +1075,126 @@ _unur_ars_reinit( struct unur_gen *gen )
 
 /*---------------------------------------------------------------------------*/
 
+int
+_unur_ars_reinit_warm( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* re-initialize (existing) generator by reusing the construction       */
+     /* points of the current hat (warm start).                              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   At most GEN->warm_ncpoints construction points are retained.       */
+     /*   These are the points that are closest to equidistributed           */
+     /*   percentiles of the old hat. The other intervals are removed.       */
+     /*   Then logPDF and its derivative are evaluated at the retained       */
+     /*   points and the hat is recomputed without allocating new            */
+     /*   intervals (unless the hat is unbounded and we have to split).      */
+     /*   The new logPDF must be concave at the retained points: the         */
+     /*   derivatives must be non-increasing and the tangent at each point   */
+     /*   must not be below logPDF at its neighbors. Otherwise the PDF       */
+     /*   might not be log-concave any more and UNUR_FAILURE is returned.    */
+     /*   If this fails, the hat is corrupted and must be rebuilt.           */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_ars_interval *iv, *next;
+  double Acum_left;      /* area below hat left of construction point        */
+  double Aquant;         /* area below hat left of next percentile           */
+  int n;                 /* number of next percentile                        */
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_ARS_GEN,UNUR_ERR_COOKIE);
+
+  if (GEN->iv == NULL || GEN->iv->next == NULL || !(GEN->Atotal > 0.))
+    return UNUR_FAILURE;
+
+  /* remove interior construction points that are not close to one of the */
+  /* percentiles (i+0.5)/warm_ncpoints of the old hat.                     */
+  /* The first and the last point in the list are always retained since   */
+  /* they define the boundary of the support of the hat.                  */
+  if (GEN->n_ivs > GEN->warm_ncpoints) {
+    n = 0;
+    Aquant = 0.5 * GEN->Atotal / GEN->warm_ncpoints;
+    Acum_left = GEN->iv->Acum;
+    for (iv = GEN->iv; iv->next->next != NULL; ) {
+      next = iv->next;
+      if (n < GEN->warm_ncpoints && Acum_left >= Aquant) {
+	/* keep point */
+	while (n < GEN->warm_ncpoints && Acum_left >= Aquant)
+	  Aquant = (++n + 0.5) * GEN->Atotal / GEN->warm_ncpoints;
+	Acum_left = next->Acum;
+	iv = next;
+      }
+      else {
+	/* remove point */
+	Acum_left = next->Acum;
+	iv->next = next->next;
+	free(next);
+	--(GEN->n_ivs);
+      }
+    }
+  }
+
+  /* update values of logPDF and its derivative */
+  for (iv = GEN->iv; iv != NULL; iv = iv->next) {
+    iv->logfx = _unur_isfinite(iv->x) ? logPDF(iv->x) : -UNUR_INFINITY;
+    if (!(iv->logfx < UNUR_INFINITY))
+      /* overflow */
+      return UNUR_FAILURE;
+    if (!_unur_isfinite(iv->logfx)) {
+      /* we cannot shrink the support of the hat: a point with logPDF(x)=-inf */
+      /* is only allowed at the boundary of the domain.                       */
+      if (iv != GEN->iv && iv->next != NULL)
+	return UNUR_FAILURE;
+    }
+    else if ( (iv == GEN->iv && !_unur_FP_same(iv->x, DISTR.BD_LEFT)) ||
+	      (iv->next == NULL && !_unur_FP_same(iv->x, DISTR.BD_RIGHT)) )
+      /* the support of the new PDF might be larger than that of the old one */
+      return UNUR_FAILURE;
+    iv->dlogfx = _unur_isfinite(iv->logfx) ? dlogPDF(iv->x) : UNUR_INFINITY;
+    if ( !(iv->dlogfx > -UNUR_INFINITY))
+      iv->dlogfx = UNUR_INFINITY;
+  }
+
+  /* check log-concavity at retained construction points */
+  for (iv = GEN->iv; iv->next != NULL; iv = iv->next) {
+    next = iv->next;
+    if (!_unur_isfinite(iv->logfx) || !_unur_isfinite(next->logfx) ||
+	!_unur_isfinite(iv->dlogfx) || !_unur_isfinite(next->dlogfx) )
+      /* boundary of support or very steep tangent: checked when computing hat */
+      continue;
+    if ( _unur_FP_less( iv->dlogfx, next->dlogfx ) ||
+	 _unur_FP_greater( next->logfx, iv->logfx + iv->dlogfx * (next->x - iv->x) ) ||
+	 _unur_FP_greater( iv->logfx, next->logfx + next->dlogfx * (iv->x - next->x) ) )
+      /* not log-concave */
+      return UNUR_FAILURE;
+  }
+
+  /* compute intervals for construction points */
+  if (_unur_ars_starting_intervals(gen)!=UNUR_SUCCESS)
+    return UNUR_FAILURE;
+
+  /* update maximal number of intervals */
+  if (GEN->n_ivs > GEN->max_ivs)
+    GEN->max_ivs = GEN->n_ivs;
+
+  /* make table of areas */
+  _unur_ars_make_area_table(gen);
+
+  /* is there any hat at all ? */
+  if (!(GEN->Atotal > 0.))
+    return UNUR_FAILURE;
+
+  return UNUR_SUCCESS;
+} /* end of _unur_ars_reinit_warm() */
+
+/*---------------------------------------------------------------------------*/
+
 struct unur_gen *
 _unur_ars_create( struct unur_par *par )
      /*----------------------------------------------------------------------*/
@@ -1043,6 +1228,7 @@ _unur_ars_create( struct unur_par *par )
   SAMPLE = _unur_ars_getSAMPLE(gen);
   gen->destroy = _unur_ars_free;
   gen->clone = _unur_ars_clone;
+  gen->memsize = _unur_ars_memsize;
   gen->reinit = _unur_ars_reinit;
 
   /* set all pointers to NULL */
@@ -1068,6 +1254,8 @@ _unur_ars_create( struct unur_par *par )
 
   /* copy all other parameters */
   GEN->retry_ncpoints = PAR->retry_ncpoints;   /* number of cpoints for second trial of reinit */
+  GEN->warm_ncpoints = PAR->warm_ncpoints;     /* number of cpoints retained by reinit */
+  GEN->not_logconcave = FALSE;                 /* no violation of log-concavity found yet */
 
   /* bounds for adding construction points  */
   GEN->max_ivs = _unur_max(2*PAR->n_starting_cpoints,PAR->max_ivs);  /* maximum number of intervals */
@@ -1206,6 +1394,31 @@ _unur_ars_free( struct unur_gen *gen )
 
 } /* end of _unur_ars_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_ars_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+  struct unur_ars_interval *iv;
+
+  /* linked list of intervals */
+  for (iv = GEN->iv; iv != NULL; iv = iv->next)
+    size += sizeof(struct unur_ars_interval);
+
+  /* starting points and percentiles */
+  if (GEN->starting_cpoints) size += GEN->n_starting_cpoints * sizeof(double);
+  if (GEN->percentiles) size += GEN->n_percentiles * sizeof(double);
+
+  return size;
+} /* end of _unur_ars_memsize() */
+
 /*****************************************************************************/
 
 double
@@ -1265,7 +1478,10 @@ _unur_ars_sample( struct unur_gen *gen )
     return UNUR_INFINITY;
   } 
 
+  _unur_stats_count(gen,sample);
+
   for (n_trials=0; n_trials<GEN->max_iter; ++n_trials) {
+    _unur_stats_count(gen,trial);
 
     /* sample from U(0,1) */
     U = _unur_call_urng(gen->urng);
@@ -1278,6 +1494,7 @@ _unur_ars_sample( struct unur_gen *gen )
     U *= GEN->Atotal;
     while (iv->Acum < U) {
       iv = iv->next;
+      _unur_stats_count(gen,search);
     }
 
     /* reuse of uniform random number */
@@ -1324,10 +1541,13 @@ _unur_ars_sample( struct unur_gen *gen )
     logsqx = rescaled_logf(iv->logfx) + iv->sq*(X - iv->x);
  
     /* below squeeze ? */
-    if (logV <= logsqx)
+    if (logV <= logsqx) {
+      _unur_stats_count(gen,squeeze);
       return X;
+    }
     
     /* log of PDF at x */
+    _unur_stats_count(gen,pdf);
     logfx = logPDF(X);
 
     /* below PDF ? */
@@ -1606,6 +1826,7 @@ _unur_ars_improve_hat( struct unur_gen *gen, struct unur_ars_interval *iv,
   if (result!=UNUR_SUCCESS && result!=UNUR_ERR_SILENT) {
     /* condition for PDF is violated! */
     _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"");
+    GEN->not_logconcave = TRUE;
     if (gen->variant & ARS_VARFLAG_PEDANTIC) {
       /* replace sampling routine by dummy routine that just returns UNUR_INFINITY */
       SAMPLE = _unur_sample_cont_error;
@@ -2502,7 +2723,12 @@ _unur_ars_debug_reinit_start( const struct unur_gen *gen )
   fprintf(LOG,"%s: *** Re-Initialize generator object ***\n",gen->genid);
   fprintf(LOG,"%s:\n",gen->genid);
 
-  if (gen->set & ARS_SET_N_PERCENTILES) {
+  if (GEN->warm_ncpoints > 0) {
+    fprintf(LOG,"%s: warm start: reuse (at most %d) construction points of old hat if possible.\n",
+	    gen->genid, GEN->warm_ncpoints);
+    fprintf(LOG,"%s: otherwise ",gen->genid);
+  }
+  if (gen->set & ARS_SET_N_PERCENTILES && GEN->warm_ncpoints == 0) {
     fprintf(LOG,"%s: use percentiles of old hat as starting points for new hat:",gen->genid);
     for (i=0; i<GEN->n_percentiles; i++) {
       if (i%5==0) fprintf(LOG,"\n%s:\t",gen->genid);
@@ -2516,7 +2742,10 @@ _unur_ars_debug_reinit_start( const struct unur_gen *gen )
     fprintf(LOG,"\n");
   }
   else {
-    fprintf(LOG,"%s: use starting points given at init\n",gen->genid);
+    if (GEN->warm_ncpoints > 0) 
+      fprintf(LOG,"use starting points given at init\n");
+    else
+      fprintf(LOG,"%s: use starting points given at init\n",gen->genid);
   }
   
   fprintf(LOG,"%s:\n",gen->genid);
@@ -2870,6 +3099,7 @@ _unur_ars_info( struct unur_gen *gen, int help )
        int unur_ars_set_cpoints( UNUR_PAR *parameters, int n_cpoints, const double *cpoints );
        int unur_ars_set_reinit_percentiles( UNUR_PAR *parameters, int n_percentiles, const double *percentiles );
        int unur_ars_set_reinit_ncpoints( UNUR_PAR *parameters, int ncpoints );
+       int unur_ars_set_reinit_warmstart( UNUR_PAR *parameters, int ncpoints );
     */
   }
 
@@ -92,6 +92,10 @@
       This feature is usefull when the underlying distribution object
       is only moderately changed. (An example is Gibbs sampling with
       small correlations.)
+      Alternatively, the construction points of the old hat function
+      can be reused directly (warm start, see
+      unur_ars_set_reinit_warmstart()). Then no new hat has to be
+      built from scratch and the intervals need not be reallocated.
 
       There exists a test mode that verifies whether the conditions for
       the method are satisfied or not. It can be switched on by calling 
@@ -176,6 +180,37 @@ int unur_ars_chg_reinit_ncpoints( UNUR_GEN *generator, int ncpoints );
    Default: @code{30}
  */
 
+int unur_ars_set_reinit_warmstart( UNUR_PAR *parameters, int ncpoints );
+/* 
+   When the generator object is reinitialized then first try to reuse
+   (at most) @var{ncpoints} construction points of the old hat
+   function (warm start). These points are selected close to
+   equidistributed percentiles of the old hat. Only the values of the
+   logPDF and its derivative are recomputed at these points. The
+   interval structures of the old hat are reused, i.e., no memory is
+   allocated and no search for construction points is run (unless an
+   unbounded hat has to be split). This is intended for distribution
+   objects that are only moderately changed (e.g., in a Gibbs sampler).
+   If the new hat cannot be constructed in this way (e.g., because
+   the support of the PDF has changed or the new logPDF is not
+   concave at the retained construction points), then the
+   construction points given by unur_ars_set_cpoints() are used.
+   If sampling from the old hat has shown that the PDF is not
+   log-concave, then no construction points are reused and the
+   generator is reinitialized as without warm start.
+   (Otherwise the percentiles set by
+   unur_ars_set_reinit_percentiles() are ignored when warm start is
+   enabled.)
+
+   @var{ncpoints} must be at least @code{2}. If @var{ncpoints} is
+   @code{0} then warm start is disabled.
+   
+   Notice that the resulting generator object differs from that
+   obtained by a reinit without warm start.
+
+   Default: @code{0} (disabled)
+*/
+
 int unur_ars_set_max_iter( UNUR_PAR *parameters, int max_iter );
 /* 
    The rejection loop stops after @var{max_iter} iterations and return
@@ -42,6 +42,7 @@ struct unur_ars_par {
   const double *percentiles; /* percentiles of hat for c. points of new hat  */
   int n_percentiles;         /* number of percentiles                        */
   int retry_ncpoints;        /* number of cpoints for second trial of reinit */
+  int warm_ncpoints;         /* max. number of cpoints retained by reinit    */
 
   int max_ivs;               /* maximum number of intervals                  */
   int max_iter;              /* maximum number of iterations                 */
@@ -90,6 +91,9 @@ struct unur_ars_gen {
   double *percentiles;       /* percentiles of hat for c. points of new hat  */
   int n_percentiles;         /* number of percentiles                        */
   int retry_ncpoints;        /* number of cpoints for second trial of reinit */
+  int warm_ncpoints;         /* max. number of cpoints retained by reinit    */
+  int not_logconcave;        /* TRUE if splitting detected that PDF is not   */
+                             /*   log-concave                                */
 };
 
 /*---------------------------------------------------------------------------*/
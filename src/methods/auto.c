@@ -34,6 +34,8 @@
 
 #include <unur_source.h>
 #include <distr/distr.h>
+#include <distr/distr_source.h>
+#include <distributions/unur_stddistr.h>
 #include <urng/urng.h>
 #include "unur_methods_source.h"
 #include "x_gen_source.h"
@@ -43,11 +45,14 @@
 
 #include "cstd.h"
 #include "dari.h"
+#include "dau.h"
 #include "dgt.h"
 #include "dstd.h"
 #include "empk.h"
+#include "hinv.h"
 #include "hist.h"
 #include "mvstd.h"
+#include "pinv.h"
 #include "tdr.h"
 #include "vempk.h"
 
@@ -65,6 +70,42 @@
 /* Flags for logging set calls                                               */
 
 #define AUTO_SET_LOGSS          0x001u
+#define AUTO_SET_MAX_SETUP      0x002u
+
+/*---------------------------------------------------------------------------*/
+/* Cost model                                                                */
+/*                                                                           */
+/* Costs are given relative to the marginal generation time of method TDR.   */
+/* They have been calibrated by means of unur_test_timing_R() for a couple   */
+/* of standard distributions (normal, gamma, beta, Cauchy, binomial,         */
+/* Poisson, geometric) and are rounded conservatively.                       */
+/* The setup of DGT and DAU grows linearly with the length of the PV;        */
+/* AUTO_PV_LENGTH is used when the length is unknown, i.e., when only the    */
+/* PMF is given.                                                             */
+
+#define AUTO_N_CANDIDATES  (4)     /* maximal number of candidates           */
+#define AUTO_PV_LENGTH     (64)    /* assumed length of PV if unknown        */
+
+struct unur_auto_cost {
+  unsigned method;                 /* candidate method                       */
+  double setup;                    /* (fixed) setup cost                     */
+  double setup_pv;                 /* setup cost per entry of PV             */
+  double marginal;                 /* marginal generation cost               */
+};
+
+static const struct unur_auto_cost _unur_auto_cost_cont[] = {
+  { UNUR_METH_CSTD,   10.,  0.,  1.5  },
+  { UNUR_METH_TDR,   250.,  0.,  1.0  },
+  { UNUR_METH_HINV, 6000.,  0.,  0.75 },
+  { UNUR_METH_PINV, 8000.,  0.,  0.7  },
+};
+
+static const struct unur_auto_cost _unur_auto_cost_discr[] = {
+  { UNUR_METH_DSTD,   10.,  0.,  1.5  },
+  { UNUR_METH_DARI,   30.,  0.,  0.9  },
+  { UNUR_METH_DGT,    20.,  1.5, 0.45 },
+  { UNUR_METH_DAU,    20.,  1.7, 0.5  },
+};
 
 /*---------------------------------------------------------------------------*/
 
@@ -80,6 +121,8 @@ static struct unur_gen *_unur_auto_init( struct unur_par *par );
 static struct unur_gen *_unur_init_cont( struct unur_par *par );
 static struct unur_gen *_unur_init_cvec( struct unur_par *par );
 static struct unur_gen *_unur_init_discr( struct unur_par *par );
+static struct unur_gen *_unur_init_costmodel( struct unur_par *par_auto,
+					      const struct unur_auto_cost *table, int n_table );
 static struct unur_gen *_unur_init_cemp( struct unur_par *par );
 static struct unur_gen *_unur_init_cvemp( struct unur_par *par );
 /*---------------------------------------------------------------------------*/
@@ -93,10 +136,21 @@ static struct unur_gen *_unur_init_cvemp( struct unur_par *par );
 /* no such functions!                                                        */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_auto_candidate_ok( const struct unur_distr *distr, unsigned method );
+/*---------------------------------------------------------------------------*/
+/* check whether the data required by candidate method are available.        */
+/*---------------------------------------------------------------------------*/
+
+static struct unur_par *_unur_auto_candidate_new( const struct unur_distr *distr, unsigned method );
+/*---------------------------------------------------------------------------*/
+/* create parameter object for candidate method.                             */
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /* abbreviations */
 
 #define PAR       ((struct unur_auto_par*)par->datap) /* data for parameter object */
+#define PAR_AUTO  ((struct unur_auto_par*)par_auto->datap) /* same for par_auto   */
 
 /*---------------------------------------------------------------------------*/
 
@@ -143,6 +197,9 @@ unur_auto_new( const struct unur_distr *distr )
 
   par->debug    = _unur_default_debugflag; /* set default debugging flags    */
 
+  PAR->logss     = 10;             /* common logarithm of sample size        */
+  PAR->max_setup = UNUR_INFINITY;  /* no bound for setup costs               */
+
   /* routine for starting generator */
   par->init = _unur_auto_init;
 
@@ -187,6 +244,43 @@ unur_auto_set_logss( UNUR_PAR *par, int logss )
 
 } /* end of unur_auto_set_logss() */
 
+/*---------------------------------------------------------------------------*/
+
+int 
+unur_auto_set_max_setup( UNUR_PAR *par, double max_setup )
+     /*----------------------------------------------------------------------*/
+     /* set upper bound for setup costs                                      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par       ... pointer to parameter for building generator object   */
+     /*   max_setup ... maximal setup costs                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+
+  /* check input */
+  _unur_check_par_object( par, AUTO );
+
+  if (! (max_setup > 0.) ) {
+    _unur_warning(GENTYPE,UNUR_ERR_PAR_SET,"max_setup <= 0");
+    return UNUR_ERR_PAR_SET;
+  }
+
+  /* store date */
+  PAR->max_setup = max_setup;
+
+  /* changelog */
+  par->set |= AUTO_SET_MAX_SETUP;
+
+  return UNUR_SUCCESS;
+
+} /* end of unur_auto_set_max_setup() */
+
 
 /*****************************************************************************/
 /**  Private                                                                **/
@@ -281,6 +375,23 @@ _unur_init_cont( struct unur_par *par_auto )
   struct unur_par *par;
   struct unur_gen *gen;
 
+  /* order statistics and transformed RVs: */
+  /* try special generator or inversion first */
+  if ( (par_auto->distr->id == UNUR_DISTR_CORDER ||
+	par_auto->distr->id == UNUR_DISTR_CXTRANS) &&
+       ( par_auto->distr->data.cont.invcdf != NULL ||
+	 ( par_auto->distr->data.cont.init != NULL &&
+	   (par_auto->distr->set & UNUR_DISTR_SET_STDDOMAIN) ) ) ) {
+    par = unur_cstd_new(par_auto->distr);
+    gen = (par) ? unur_init(par) : NULL;
+    if (gen) return gen;
+  }
+
+  /* use cost model if the task has been described by the user */
+  if (par_auto->set & (AUTO_SET_LOGSS | AUTO_SET_MAX_SETUP))
+    return _unur_init_costmodel( par_auto, _unur_auto_cost_cont,
+				 (int)(sizeof(_unur_auto_cost_cont)/sizeof(struct unur_auto_cost)) );
+
   do {
     /* 1st choice: TDR */
     par = unur_tdr_new(par_auto->distr);
@@ -346,6 +457,11 @@ _unur_init_discr( struct unur_par *par_auto )
   struct unur_par *par;
   struct unur_gen *gen;
   
+  /* use cost model if the task has been described by the user */
+  if (par_auto->set & (AUTO_SET_LOGSS | AUTO_SET_MAX_SETUP))
+    return _unur_init_costmodel( par_auto, _unur_auto_cost_discr,
+				 (int)(sizeof(_unur_auto_cost_discr)/sizeof(struct unur_auto_cost)) );
+
   do {
     /* 1st choice: DGT */
     if (par_auto->distr->data.discr.pv != NULL) {
@@ -442,6 +558,157 @@ _unur_init_cvemp( struct unur_par *par_auto )
   
 /*---------------------------------------------------------------------------*/
 
+/*****************************************************************************/
+/**  Cost model                                                             **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+struct unur_gen *
+_unur_init_costmodel( struct unur_par *par_auto,
+		      const struct unur_auto_cost *table, int n_table )
+     /*----------------------------------------------------------------------*/
+     /* initialize new generator using the method with the smallest          */
+     /* expected total costs (setup + sample size * marginal costs).         */
+     /* Candidates with setup costs exceeding the given bound are only       */
+     /* used when all other candidates have failed.                          */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par_auto ... pointer to paramters for building generator object    */
+     /*   table    ... table of costs for candidate methods                  */
+     /*   n_table  ... number of entries in table                            */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to generator object                                        */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return NULL                                                        */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_par *par;
+  struct unur_gen *gen = NULL;
+  const struct unur_distr *distr = par_auto->distr;
+  double samplesize, setup, cost[AUTO_N_CANDIDATES];
+  int over[AUTO_N_CANDIDATES];
+  int order[AUTO_N_CANDIDATES];
+  int n_pv, n, i, j, tmp;
+
+  CHECK_NULL(table,NULL);
+  if (n_table > AUTO_N_CANDIDATES) n_table = AUTO_N_CANDIDATES;
+
+  samplesize = pow(10., (double) PAR_AUTO->logss);
+
+  n_pv = (distr->type == UNUR_DISTR_DISCR && distr->data.discr.pv != NULL)
+    ? distr->data.discr.n_pv : AUTO_PV_LENGTH;
+
+  /* expected costs of candidates */
+  for (n=0, i=0; i<n_table; i++) {
+    if (!_unur_auto_candidate_ok(distr,table[i].method))
+      continue;
+    setup = table[i].setup + table[i].setup_pv * n_pv;
+    order[n] = i;
+    over[i] = (setup > PAR_AUTO->max_setup) ? TRUE : FALSE;
+    cost[i] = setup + samplesize * table[i].marginal;
+    ++n;
+  }
+
+  /* sort candidates: admissible ones first, then by expected costs */
+  /* (insertion sort; there are only a few candidates)              */
+  for (i=1; i<n; i++) {
+    for (j=i; j>0; j--) {
+      if ( over[order[j-1]] < over[order[j]] ||
+	   ( over[order[j-1]] == over[order[j]] && cost[order[j-1]] <= cost[order[j]] ) )
+	break;
+      tmp = order[j]; order[j] = order[j-1]; order[j-1] = tmp;
+    }
+  }
+
+  /* try candidates */
+  for (i=0; i<n; i++) {
+    par = _unur_auto_candidate_new(distr,table[order[i]].method);
+    gen = unur_init(par);
+    if (gen) break;
+  }
+
+  return gen;
+} /* end of _unur_init_costmodel() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_auto_candidate_ok( const struct unur_distr *distr, unsigned method )
+     /*----------------------------------------------------------------------*/
+     /* check whether the data required by candidate method are available.   */
+     /* (This is just a quick check. The method may fail nevertheless.)      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   distr  ... pointer to distribution object                          */
+     /*   method ... candidate method                                        */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   TRUE  ... if method might work                                     */
+     /*   FALSE ... otherwise                                                */
+     /*----------------------------------------------------------------------*/
+{
+  switch (method) {
+  case UNUR_METH_CSTD:
+    return (distr->data.cont.init != NULL || distr->data.cont.invcdf != NULL);
+  case UNUR_METH_TDR:
+    return ( (distr->data.cont.pdf != NULL && distr->data.cont.dpdf != NULL) ||
+	     (distr->data.cont.logpdf != NULL && distr->data.cont.dlogpdf != NULL) );
+  case UNUR_METH_HINV:
+    return (distr->data.cont.cdf != NULL);
+  case UNUR_METH_PINV:
+    return (distr->data.cont.pdf != NULL || distr->data.cont.cdf != NULL);
+
+  case UNUR_METH_DSTD:
+    return (distr->data.discr.init != NULL || distr->data.discr.invcdf != NULL);
+  case UNUR_METH_DARI:
+    return (distr->data.discr.pmf != NULL);
+  case UNUR_METH_DGT:
+  case UNUR_METH_DAU:
+    return (distr->data.discr.pv != NULL || distr->data.discr.pmf != NULL);
+
+  default:
+    return FALSE;
+  }
+} /* end of _unur_auto_candidate_ok() */
+
+/*---------------------------------------------------------------------------*/
+
+struct unur_par *
+_unur_auto_candidate_new( const struct unur_distr *distr, unsigned method )
+     /*----------------------------------------------------------------------*/
+     /* create parameter object for candidate method.                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   distr  ... pointer to distribution object                          */
+     /*   method ... candidate method                                        */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to parameter object                                        */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return NULL                                                        */
+     /*----------------------------------------------------------------------*/
+{
+  switch (method) {
+  case UNUR_METH_CSTD:  return unur_cstd_new(distr);
+  case UNUR_METH_TDR:   return unur_tdr_new(distr);
+  case UNUR_METH_HINV:  return unur_hinv_new(distr);
+  case UNUR_METH_PINV:  return unur_pinv_new(distr);
+  case UNUR_METH_DSTD:  return unur_dstd_new(distr);
+  case UNUR_METH_DARI:  return unur_dari_new(distr);
+  case UNUR_METH_DGT:   return unur_dgt_new(distr);
+  case UNUR_METH_DAU:   return unur_dau_new(distr);
+  default:
+    _unur_error(GENTYPE,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
+    return NULL;
+  }
+} /* end of _unur_auto_candidate_new() */
+
+/*---------------------------------------------------------------------------*/
+
 /*****************************************************************************/
 /**  Debugging utilities                                                    **/
 /*****************************************************************************/
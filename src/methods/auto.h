@@ -44,10 +44,7 @@
 
    =DESCRIPTION
       AUTO selects a an appropriate method for the given distribution
-      object automatically. There are no parameters for this method,
-      yet. But it is planned to give some parameter to describe the
-      task for which the random variate generator is used for and thus
-      make the choice of the generating method more appropriate.
+      object automatically.
       Notice that the required sampling routine for the generator
       object depends on the type of the given distribution object.
 
@@ -56,6 +53,29 @@
       the order of magnitude of the sample size should be set via a
       unur_auto_set_logss() call.
 
+      When the sample size (or a bound for the setup time via
+      unur_auto_set_max_setup()) is given, then for continuous and
+      discrete univariate distributions AUTO estimates the total
+      generation time, i.e., setup time plus sample size times
+      marginal generation time, for each of the candidate methods
+      CSTD, TDR, HINV, and PINV (continuous) and
+      DSTD, DARI, DGT, and DAU (discrete), respectively,
+      and chooses the method with the smallest expected costs
+      among those for which the required data are available.
+      The estimates are taken from a built-in table of relative costs
+      which have been calibrated for a couple of standard
+      distributions. If the chosen method cannot be initialized, then
+      the candidate with the next smallest costs is tried.
+      Otherwise a fixed list of methods is tried (TDR, CSTD for
+      continuous distributions; DGT, DARI, DSTD for discrete
+      distributions).
+
+      For order statistics (@pxref{CORDER}) and transformed random
+      variables (@pxref{CXTRANS}) of standard distributions, or of
+      distributions with given inverse CDF, method CSTD is always
+      tried first, since it does not require the PDF of the derived
+      distribution.
+
       IMPORTANT: This is an experimental version and the method chosen
       may change in future releases of UNU.RAN.
 
@@ -87,7 +107,28 @@ int unur_auto_set_logss( UNUR_PAR *parameters, int logss );
 
    Default is 10.
 
-   Notice: This feature will be used in future releases of UNU.RAN only.
+   If this call is used then the method is selected by means of the
+   built-in cost model (see above). For small samples methods with
+   fast setup like CSTD, DSTD, or DARI are preferred while for large
+   samples fast inversion methods like PINV, HINV, DGT, or DAU are
+   chosen.
+*/
+
+int unur_auto_set_max_setup( UNUR_PAR *parameters, double max_setup );
+/* 
+   Set an upper bound for the setup time of the chosen method.
+   Candidate methods with larger (estimated) setup time are only used
+   when all other candidates fail.
+   The setup time has to be given in multiples of the marginal
+   generation time of method TDR (which is about the time for
+   generating an exponential random variate by inversion).
+   For example, a bound of @code{1000} usually excludes the table
+   based inversion methods PINV and HINV.
+
+   If this call is used then the method is selected by means of the
+   built-in cost model (see above).
+
+   Default is @code{UNUR_INFINITY}.
 */
 
 /* =END */
@@ -37,6 +37,7 @@
 
 struct unur_auto_par {
   int logss;                       /* logarithm of sample size               */
+  double max_setup;                /* upper bound for setup costs            */
 };
 
 /*---------------------------------------------------------------------------*/
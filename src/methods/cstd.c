@@ -144,6 +144,11 @@ static void _unur_cstd_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_cstd_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /* There are no sampling routines, since every distribution has its own.     */
 /* Sampling routines are defined in ../distributions/ for each distributions.*/
@@ -331,6 +336,7 @@ unur_cstd_chg_truncated( struct unur_gen *gen, double left, double right )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, CSTD, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* domain can only be changed for inversion method! */
   if ( ! GEN->is_inversion ) { 
@@ -543,6 +549,7 @@ _unur_cstd_create( struct unur_par *par )
   SAMPLE = NULL;      /* will be set in _unur_cstd_init() */
   gen->destroy = _unur_cstd_free;
   gen->clone = _unur_cstd_clone;
+  gen->memsize = _unur_cstd_memsize;
   gen->reinit = _unur_cstd_reinit;
 
   /* defaults */
@@ -682,6 +689,21 @@ _unur_cstd_free( struct unur_gen *gen )
 
 } /* end of _unur_cstd_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_cstd_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  /* parameters for special generator */
+  return ((GEN->gen_param) ? GEN->n_gen_param * sizeof(double) : 0);
+} /* end of _unur_cstd_memsize() */
+
 /*****************************************************************************/
 
 /** 
@@ -62,6 +62,18 @@
       For some distributions more than one special generator
       is possible. 
 
+      CSTD also works for order statistics (@pxref{CORDER}) of
+      standard distributions. It then draws a beta distributed
+      random variate and applies the inverse CDF of the underlying
+      distribution. If the latter is not available it is approximated
+      by means of method PINV (@pxref{PINV}) during setup.
+      Similarly, for transformed random variables (@pxref{CXTRANS})
+      of standard distributions the random variates of the
+      underlying distribution are drawn by its special generator
+      (with the same variant) and transformed. If the underlying
+      distribution has an inverse CDF, then so has the transformed
+      random variable.
+
    =HOWTOUSE
       Create a distribution object for a standard distribution
       from the UNU.RAN library 
@@ -86,6 +86,7 @@
 
 #define DARI_SET_CFACTOR        0x001u
 #define DARI_SET_TABLESIZE      0x002u
+#define DARI_SET_EAGERTABLE     0x004u
 
 /*---------------------------------------------------------------------------*/
 
@@ -123,17 +124,32 @@ static void _unur_dari_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_dari_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_dari_sample( struct unur_gen *gen );
 static int _unur_dari_sample_check( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_dari_sample_array( struct unur_gen *gen, int *K, int n );
+/*---------------------------------------------------------------------------*/
+/* sample array of random variates (table computed during setup)             */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_dari_hat( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* compute hat.                                                              */
 /*---------------------------------------------------------------------------*/
 
+static void _unur_dari_make_table( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* compute all entries of auxiliary table.                                   */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -166,6 +182,7 @@ static void _unur_dari_info( struct unur_gen *gen, int help );
 #define BD_RIGHT  domain[1]             /* right boundary of domain of distribution */
 
 #define SAMPLE    gen->sample.discr     /* pointer to sampling routine       */     
+#define SAMPLE_ARRAY gen->sample_array.discr /* pointer to routine for arrays */
 
 #define PMF(x)    _unur_discr_PMF((x),(gen->distr))    /* call to PMF        */
 
@@ -182,6 +199,10 @@ static void _unur_dari_info( struct unur_gen *gen, int help );
    ( ((gen)->variant & DARI_VARFLAG_VERIFY) \
      ? _unur_dari_sample_check : _unur_dari_sample )
 
+#define _unur_dari_getSAMPLE_ARRAY(gen) \
+   ( (GEN->eager && !((gen)->variant & DARI_VARFLAG_VERIFY)) \
+     ? _unur_dari_sample_array : NULL )
+
 /*---------------------------------------------------------------------------*/
 
 /*****************************************************************************/
@@ -249,6 +270,8 @@ unur_dari_new( const struct unur_distr *distr )
   /* all integers close to the mode when needed the first time while         */
   /* sampling; can speed up the generation considerably.                     */
 
+  PAR->eager     = FALSE; /* table is filled while sampling                   */
+
   par->method   = UNUR_METH_DARI;     /* method                              */
   par->variant  = 0u;                 /* default variant                     */
   par->set      = 0u;                 /* inidicate default parameters        */    
@@ -342,6 +365,39 @@ unur_dari_set_squeeze( struct unur_par *par, int squeeze )
 
 /*---------------------------------------------------------------------------*/
 
+int
+unur_dari_set_eagertable( struct unur_par *par, int eager )
+     /*----------------------------------------------------------------------*/
+     /* compute auxiliary table during setup                                 */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par   ... pointer to parameter for building generator object       */
+     /*   eager ... 0 = fill table while sampling, !0 = compute during setup */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  
+  /* check input */
+  _unur_check_par_object( par, DARI );
+
+  /* store data */
+  PAR->eager = (eager) ? TRUE : FALSE;
+
+  /* changelog */
+  par->set |= DARI_SET_EAGERTABLE;
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+
+} /* end of unur_dari_set_eagertable() */
+
+/*---------------------------------------------------------------------------*/
+
 int
 unur_dari_set_tablesize( struct unur_par *par, int size )
      /*----------------------------------------------------------------------*/
@@ -436,6 +492,7 @@ unur_dari_chg_verify( struct unur_gen *gen, int verify )
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DARI, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* we must not change this switch when sampling has been disabled by
      using a pointer to the error producing routine                          */
@@ -450,6 +507,7 @@ unur_dari_chg_verify( struct unur_gen *gen, int verify )
     gen->variant &= ~DARI_VARFLAG_VERIFY;
 
   SAMPLE = _unur_dari_getSAMPLE(gen); 
+  SAMPLE_ARRAY = _unur_dari_getSAMPLE_ARRAY(gen);
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -544,6 +602,7 @@ _unur_dari_reinit( struct unur_gen *gen )
 
   /* (re)set sampling routine */
   SAMPLE = _unur_dari_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_dari_getSAMPLE_ARRAY(gen);
 
 #ifdef UNUR_ENABLE_LOGGING
   /* write info into LOG file */
@@ -590,11 +649,16 @@ _unur_dari_create( struct unur_par *par )
   SAMPLE = _unur_dari_getSAMPLE(gen);
   gen->destroy = _unur_dari_free;
   gen->clone = _unur_dari_clone;
+  gen->memsize = _unur_dari_memsize;
   gen->reinit = _unur_dari_reinit;
 
   /* copy some parameters into generator object */
   GEN->squeeze = PAR->squeeze;        /* squeeze yes/no?                       */
   GEN->c_factor = PAR->c_factor;      /* constant for choice of design point   */
+  GEN->eager = PAR->eager;            /* compute table during setup?           */
+
+  /* routine for sampling arrays */
+  SAMPLE_ARRAY = _unur_dari_getSAMPLE_ARRAY(gen);
 
   /* size of auxiliary table; 0 for none
      it cannot be larger than the given domain (avoid overflow) */
@@ -768,6 +832,26 @@ _unur_dari_free( struct unur_gen *gen )
 
 } /* end of _unur_dari_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_dari_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+
+  /* auxiliary tables */
+  if (GEN->hp) size += GEN->size * sizeof(double);
+  if (GEN->hb) size += GEN->size * sizeof(char);
+
+  return size;
+} /* end of _unur_dari_memsize() */
+
 /*****************************************************************************/
 
 int
@@ -793,8 +877,11 @@ _unur_dari_sample( struct unur_gen *gen )
   /* check arguments */
   CHECK_NULL(gen,INT_MAX);  COOKIE_CHECK(gen,CK_DARI_GEN,INT_MAX);
 
+  _unur_stats_count(gen,sample);
+
   /* step 1.0 */
   while (1) {
+    _unur_stats_count(gen,trial);
     U = _unur_call_urng(gen->urng) * GEN->vt;
 
     /* step 1.1 */
@@ -802,16 +889,20 @@ _unur_dari_sample( struct unur_gen *gen )
       X = U * (GEN->ac[1]-GEN->ac[0]) / GEN->vc + GEN->ac[0]; 
       k = (int)(X+0.5);
       i = (k<GEN->m) ? 0 : 1;
-      if (GEN->squeeze && sign[i]*(GEN->ac[i]-GEN->s[i]) > sign[i]*(X-k))
+      if (GEN->squeeze && sign[i]*(GEN->ac[i]-GEN->s[i]) > sign[i]*(X-k)) {
+	_unur_stats_count(gen,squeeze);
 	return k;
+      }
       if (sign[i]*k <= sign[i]*GEN->n[i]) {
 	if (!GEN->hb[k-N0]) {
+	  _unur_stats_count(gen,pdf);
 	  GEN->hp[k-N0] = 0.5 - PMF(k)/GEN->pm;
 	  GEN->hb[k-N0] = 1;
 	}
 	h = GEN->hp[k-N0];
       }
       else {
+	_unur_stats_count(gen,pdf);
 	h = 0.5-PMF(k)/GEN->pm;
       }
       if (h <= sign[i]*(k-X))
@@ -833,17 +924,21 @@ _unur_dari_sample( struct unur_gen *gen )
       X = GEN->x[i] + (FM(U*GEN->ys[i])-GEN->y[i]) / GEN->ys[i];
       k = (int)(X+0.5);
 
-      if (GEN->squeeze && (sign[i]*k <= sign[i]*GEN->x[i]+1) && (GEN->xsq[i] <= sign[i]*(X-k))) 
+      if (GEN->squeeze && (sign[i]*k <= sign[i]*GEN->x[i]+1) && (GEN->xsq[i] <= sign[i]*(X-k))) {
+	_unur_stats_count(gen,squeeze);
 	return k;
+      }
 
       if (sign[i]*k <= sign[i]*GEN->n[i]) {
 	if (!GEN->hb[k-N0]) {
+	  _unur_stats_count(gen,pdf);
 	  GEN->hp[k-N0] = sign[i] * F(GEN->y[i]+GEN->ys[i]*(k+sign[i]*0.5-GEN->x[i])) / GEN->ys[i] - PMF(k);
 	  GEN->hb[k-N0] = 1;
 	}
 	h = GEN->hp[k-N0];
       }
       else {
+	_unur_stats_count(gen,pdf);
 	h = sign[i] * F(GEN->y[i]+GEN->ys[i]*(k+sign[i]*0.5-GEN->x[i])) / GEN->ys[i]-PMF(k);
       }
       if (sign[i]*U >= h)
@@ -854,6 +949,41 @@ _unur_dari_sample( struct unur_gen *gen )
 
 /*---------------------------------------------------------------------------*/
 
+int
+_unur_dari_sample_array( struct unur_gen *gen, int *K, int n )
+     /*----------------------------------------------------------------------*/
+     /* sample array of random variates from generator                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   K   ... pointer to array for storing random variates               */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   Only used when the auxiliary table has been computed during        */
+     /*   setup. Then all values in the table are valid and                  */
+     /*   _unur_dari_sample() does not modify the generator object           */
+     /*   (except for the counters, if enabled).                             */
+     /*----------------------------------------------------------------------*/
+{
+  int j;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_DARI_GEN,UNUR_ERR_COOKIE);
+
+  for (j=0; j<n; j++)
+    K[j] = _unur_dari_sample(gen);
+
+  return UNUR_SUCCESS;
+
+} /* end of _unur_dari_sample_array() */
+
+/*---------------------------------------------------------------------------*/
+
 int
 _unur_dari_sample_check( struct unur_gen *gen )
      /*----------------------------------------------------------------------*/
@@ -1103,11 +1233,44 @@ _unur_dari_hat( struct unur_gen *gen )
     return UNUR_ERR_GEN_DATA;
   }
 
+  /* compute auxiliary table */
+  if (GEN->eager)
+    _unur_dari_make_table(gen);
+
   /* o.k. */
   return UNUR_SUCCESS;
 
 } /* end of _unur_dari_hat() */
 
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_dari_make_table( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute all entries of auxiliary table.                              */
+     /* then the sampling routines do not modify the generator object.       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  static const int sign[2] = {-1,1};
+  int i,k;
+
+  for (k=GEN->n[0]; k<=GEN->n[1]; k++) {
+    if (k >= GEN->s[0] && k <= GEN->s[1])
+      /* center part */
+      GEN->hp[k-N0] = 0.5 - PMF(k)/GEN->pm;
+    else {
+      /* tail */
+      i = (k < GEN->s[0]) ? 0 : 1;
+      GEN->hp[k-N0] = sign[i] * F(GEN->y[i]+GEN->ys[i]*(k+sign[i]*0.5-GEN->x[i])) / GEN->ys[i] - PMF(k);
+    }
+    GEN->hb[k-N0] = 1;
+  }
+
+} /* end of _unur_dari_make_table() */
+
 /*****************************************************************************/
 /**  Debugging utilities                                                    **/
 /*****************************************************************************/
@@ -1146,6 +1309,12 @@ _unur_dari_debug_init( struct unur_gen *gen, const char *status )
     fprintf(LOG,"_check()\n");
   else
     fprintf(LOG,"()\n");
+  if (SAMPLE_ARRAY)
+    fprintf(LOG,"%s: sampling routine for arrays = _unur_dari_sample_array()\n",gen->genid);
+  fprintf(LOG,"%s:\n",gen->genid);
+
+  fprintf(LOG,"%s: table size = %d (%s)\n",gen->genid, GEN->size,
+	  (GEN->eager) ? "computed during setup" : "filled while sampling");
   fprintf(LOG,"%s:\n",gen->genid);
 
   fprintf(LOG,"%s: Data for hat and squeeze:\n",gen->genid);
@@ -1219,7 +1388,8 @@ _unur_dari_info( struct unur_gen *gen, int help )
   if (GEN->size == 0) 
     _unur_string_append(info,"   no table\n");
   else
-    _unur_string_append(info,"   use table of size %d\n", GEN->size);
+    _unur_string_append(info,"   use table of size %d%s\n", GEN->size,
+			(GEN->eager) ? " [computed during setup]" : "");
   if (GEN->squeeze)
     _unur_string_append(info,"   use squeeze\n");
   _unur_string_append(info,"\n");
@@ -1242,6 +1412,8 @@ _unur_dari_info( struct unur_gen *gen, int help )
 			(gen->set & DARI_SET_TABLESIZE) ? "" : "[default]");
     if (GEN->squeeze)
       _unur_string_append(info,"   squeeze = on\n");
+    if (GEN->eager)
+      _unur_string_append(info,"   eagertable = on\n");
 
     if (gen->set & DARI_SET_CFACTOR)
       _unur_string_append(info,"   cpfactor = %g\n",   GEN->c_factor);
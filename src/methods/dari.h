@@ -78,6 +78,10 @@
       The size of an auxiliary table can be set by unur_dari_set_tablesize().
       The expected number of evaluations can be reduced by switching
       the use of squeezes by means of unur_dari_set_squeeze().
+      By default the auxiliary table is filled while sampling. If it
+      is computed during setup (see unur_dari_set_eagertable()) then
+      the generator object is not modified by the sampling routine and
+      it can be shared by sampling contexts (see unur_gen_share()).
 
       It is possible to change the parameters and the domain of the chosen 
       distribution and run unur_reinit() to reinitialize the generator object.
@@ -134,6 +138,23 @@ int unur_dari_set_tablesize( UNUR_PAR *parameters, int size );
    Default is @code{100}.
 */
 
+int unur_dari_set_eagertable( UNUR_PAR *parameters, int eager );
+/* 
+   If @var{eager} is TRUE, then all entries of the auxiliary table
+   are computed during setup. This requires @i{size} additional
+   evaluations of the PMF (see unur_dari_set_tablesize()).
+   The sampling routines then do not modify the generator object
+   and a special routine for sampling arrays of random variates
+   (see unur_sample_discr_array()) is used.
+   Otherwise, the table is filled when its entries are required for
+   the first time while sampling.
+
+   A generator object that is shared by sampling contexts
+   (see unur_gen_share()) always uses a table computed during setup.
+
+   Default is FALSE.
+*/
+
 int unur_dari_set_cpfactor( UNUR_PAR *parameters, double cp_factor );
 /* 
    Set factor for position of the left and right construction point,
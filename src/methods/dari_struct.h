@@ -40,6 +40,7 @@ struct unur_dari_par {
                             0.. no squeeze,  1..squeeze                      */
   int     size;          /* size of table for speeding up generation         */
   double  c_factor;      /* constant for choosing the design points          */
+  int     eager;         /* whether table is computed during setup           */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -68,6 +69,7 @@ struct unur_dari_gen {
                             for which values are stored in table             */
   int     size;          /* size of the auxiliary tables                     */
   int     squeeze;       /* use squeeze yes/no                               */
+  int     eager;         /* table computed during setup yes/no               */
 
   double *hp;            /* pointer to double array of length size           */
   char   *hb;            /* pointer to boolean array of length size          */
@@ -170,6 +170,11 @@ static void _unur_dau_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_dau_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_dau_sample( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
@@ -459,6 +464,7 @@ _unur_dau_create( struct unur_par *par)
   SAMPLE = _unur_dau_getSAMPLE(gen);
   gen->destroy = _unur_dau_free;
   gen->clone = _unur_dau_clone;
+  gen->memsize = _unur_dau_memsize;
   gen->reinit = _unur_dau_reinit;
 
   /* copy parameters */
@@ -579,6 +585,26 @@ _unur_dau_free( struct unur_gen *gen )
 
 } /* end of _unur_dau_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_dau_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+
+  /* tables for alias-urn method */
+  if (GEN->qx) size += GEN->urn_size * sizeof(double);
+  if (GEN->jx) size += GEN->urn_size * sizeof(int);
+
+  return size;
+} /* end of _unur_dau_memsize() */
+
 /*****************************************************************************/
 
 int
@@ -84,6 +84,7 @@ unur_cstd_chg_pdfparams( struct unur_gen *gen, double *params, int n_params )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, CSTD, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
   if (n_params>0) CHECK_NULL(params, UNUR_ERR_NULL);
 
   /* set new parameters in distribution object */
@@ -148,6 +149,7 @@ unur_dari_chg_pmfparams( struct unur_gen *gen, double *params, int n_params )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DARI, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* set new parameters in distribution object */
   return unur_distr_discr_set_pmfparams(gen->distr,params,n_params);
@@ -179,6 +181,7 @@ unur_dari_chg_domain( struct unur_gen *gen, int left, int right )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DARI, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* check new parameter for generator */
   if (left >= right) {
@@ -223,6 +226,7 @@ unur_dari_chg_mode( struct unur_gen *gen, int mode )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DARI, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
   
   /* copy parameters */
   DISTR.mode = mode;
@@ -279,6 +283,7 @@ unur_dari_chg_pmfsum( struct unur_gen *gen, double sum )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DARI, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
   
   /* check new parameter for generator */
   if (sum <= 0.) {
@@ -569,6 +574,7 @@ unur_dstd_chg_pmfparams( struct unur_gen *gen, double *params, int n_params )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DSTD, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
   if (n_params>0) CHECK_NULL(params, UNUR_ERR_NULL);
   
   /* set new parameters in distribution object */
@@ -602,6 +608,7 @@ unur_ninv_chg_pdfparams( struct unur_gen *gen, double *params, int n_params )
   /* check arguments */
   CHECK_NULL(gen, UNUR_ERR_NULL);
   _unur_check_gen_object( gen, NINV, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
   if (n_params>0) CHECK_NULL(params, UNUR_ERR_NULL);
   
   /* set new parameters in distribution object */
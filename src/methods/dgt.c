@@ -101,6 +101,16 @@
 
 #define DGT_VAR_THRESHOLD   1000      /* above this value: use variant 1, else 2 */
 
+/*---------------------------------------------------------------------------*/
+/* Constants                                                                 */
+
+/* lazy variant: */
+#define DGT_LAZY_SHIFT      (10)      /* log2 of size of blocks of cumulated probabilities */
+#define DGT_LAZY_BLOCKSIZE  (1<<DGT_LAZY_SHIFT)
+#define DGT_LAZY_MASK       (DGT_LAZY_BLOCKSIZE-1)
+#define DGT_LAZY_MAXGUIDE   (1<<20)   /* maximal size of guide table (for guide_factor = 1) */
+#define DGT_LAZY_TAIL       (1.e-12)  /* rel. probability of tail that is chopped off */
+
 /*---------------------------------------------------------------------------*/
 /* Debugging flags                                                           */
 /*    bit  01    ... pameters and structure of generator (do not use here)   */
@@ -117,6 +127,7 @@
 
 #define DGT_SET_GUIDEFACTOR    0x010u
 #define DGT_SET_VARIANT        0x020u
+#define DGT_SET_LAZY           0x040u
 
 /*---------------------------------------------------------------------------*/
 
@@ -154,6 +165,11 @@ static void _unur_dgt_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_dgt_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_dgt_sample( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
@@ -169,6 +185,41 @@ static int _unur_dgt_make_guidetable( struct unur_gen *gen );
 /* create table for indexed search                                           */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_dgt_lazy_sample( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* sample from generator (lazy variant)                                      */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_dgt_lazy_lookup( struct unur_gen *gen, double u );
+/*---------------------------------------------------------------------------*/
+/* find index for u, compute blocks of tables when required (lazy variant)   */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_dgt_lazy_create_tables( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* create (allocate) tables and compute first block (lazy variant)           */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_dgt_lazy_free_tables( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* free blocks of cumulated probabilities (lazy variant)                     */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_dgt_lazy_extend( struct unur_gen *gen, int i );
+/*---------------------------------------------------------------------------*/
+/* compute guide table up to given index (lazy variant)                      */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_dgt_lazy_cover( struct unur_gen *gen, double thresh );
+/*---------------------------------------------------------------------------*/
+/* compute blocks of cumulated probabilities up to given threshold           */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_dgt_lazy_block( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* compute next block of cumulated probabilities (lazy variant)             */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -206,7 +257,11 @@ static void _unur_dgt_info( struct unur_gen *gen, int help );
 
 /*---------------------------------------------------------------------------*/
 
-#define _unur_dgt_getSAMPLE(gen)  (_unur_dgt_sample)
+#define _unur_dgt_getSAMPLE(gen) \
+   ( (GEN->cumblocks != NULL) ? _unur_dgt_lazy_sample : _unur_dgt_sample )
+
+/* cumulated probability for j-th point (lazy variant) */
+#define CUMPV(j)  (GEN->cumblocks[(j)>>DGT_LAZY_SHIFT][(j)&DGT_LAZY_MASK])
 
 /*---------------------------------------------------------------------------*/
 
@@ -262,6 +317,7 @@ unur_dgt_new( const struct unur_distr *distr )
 
   /* set default values */
   PAR->guide_factor = 1.;            /* use same size for guide table        */
+  PAR->lazy = FALSE;                 /* compute tables during setup          */
 
   par->method      = UNUR_METH_DGT;  /* method                               */
   par->variant     = 0u;             /* default variant                      */
@@ -348,6 +404,36 @@ unur_dgt_set_guidefactor( struct unur_par *par, double factor )
 
 } /* end of unur_dgt_set_guidefactor() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+unur_dgt_set_lazy( struct unur_par *par, int lazy )
+     /*----------------------------------------------------------------------*/
+     /* compute tables on demand during sampling                             */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par  ... pointer to parameter for building generator object        */
+     /*   lazy ... 0 = compute tables during setup, !0 = compute on demand   */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, DGT );
+
+  /* store date */
+  PAR->lazy = (lazy) ? TRUE : FALSE;
+
+  /* changelog */
+  par->set |= DGT_SET_LAZY;
+
+  return UNUR_SUCCESS;
+
+} /* end of unur_dgt_set_lazy() */
+
 
 /*****************************************************************************/
 /**  Private                                                                **/
@@ -395,6 +481,9 @@ _unur_dgt_init( struct unur_par *par )
     _unur_dgt_free(gen); return NULL;
   }
 
+  /* sampling routine depends on variant */
+  SAMPLE = _unur_dgt_getSAMPLE(gen);
+
 #ifdef UNUR_ENABLE_LOGGING
   /* write info into LOG file */
   if (gen->debug) _unur_dgt_debug_init(gen);
@@ -476,14 +565,21 @@ _unur_dgt_create( struct unur_par *par )
   SAMPLE = _unur_dgt_getSAMPLE(gen);
   gen->destroy = _unur_dgt_free;
   gen->clone = _unur_dgt_clone;
+  gen->memsize = _unur_dgt_memsize;
   gen->reinit = _unur_dgt_reinit;
 
   /* copy some parameters into generator object */
   GEN->guide_factor = PAR->guide_factor;
+  GEN->lazy = PAR->lazy;
 
   /* set all pointers to NULL */
   GEN->cumpv = NULL;
   GEN->guide_table = NULL;
+  GEN->cumblocks = NULL;
+  GEN->n_cumblocks = 0;
+  GEN->max_cumblocks = 0;
+  GEN->n_cum = 0;
+  GEN->n_guide = 0;
 
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
@@ -510,6 +606,23 @@ _unur_dgt_check_par( struct unur_gen *gen )
      /*   error code   ... on error                                          */
      /*----------------------------------------------------------------------*/
 {
+  /* lazy variant: we need PMF and sum over PMF but no PV */
+  if (GEN->lazy && DISTR.pv == NULL && DISTR.pmf != NULL && DISTR.domain[0] > INT_MIN) {
+    if (!(gen->distr->set & UNUR_DISTR_SET_PMFSUM))
+      if (unur_distr_discr_upd_pmfsum(gen->distr) != UNUR_SUCCESS) {
+	_unur_error(GENTYPE,UNUR_ERR_DISTR_REQUIRED,"sum over PMF");
+	return UNUR_ERR_DISTR_REQUIRED;
+      }
+    if (!(DISTR.sum > 0.)) {
+      _unur_error(GENTYPE,UNUR_ERR_DISTR_DATA,"sum over PMF <= 0");
+      return UNUR_ERR_DISTR_DATA;
+    }
+    return UNUR_SUCCESS;
+  }
+
+  /* tables of the lazy variant are not used any more */
+  _unur_dgt_lazy_free_tables(gen);
+
   /* we need a PV */
   if (DISTR.pv == NULL) {
     /* try to compute PV */
@@ -548,6 +661,7 @@ _unur_dgt_clone( const struct unur_gen *gen )
 #define CLONE  ((struct unur_dgt_gen*)clone->datap)
 
   struct unur_gen *clone;
+  int i;
 
   /* check arguments */
   CHECK_NULL(gen,NULL);  COOKIE_CHECK(gen,CK_DGT_GEN,NULL);
@@ -556,8 +670,18 @@ _unur_dgt_clone( const struct unur_gen *gen )
   clone = _unur_generic_clone( gen, GENTYPE );
 
   /* copy data for distribution */
-  CLONE->cumpv = _unur_xmalloc( DISTR.n_pv * sizeof(double) );
-  memcpy( CLONE->cumpv, GEN->cumpv, DISTR.n_pv * sizeof(double) );
+  if (GEN->cumblocks != NULL) {
+    /* lazy variant */
+    CLONE->cumblocks = _unur_xmalloc( GEN->max_cumblocks * sizeof(double*) );
+    for (i=0; i<GEN->n_cumblocks; i++) {
+      CLONE->cumblocks[i] = _unur_xmalloc( DGT_LAZY_BLOCKSIZE * sizeof(double) );
+      memcpy( CLONE->cumblocks[i], GEN->cumblocks[i], DGT_LAZY_BLOCKSIZE * sizeof(double) );
+    }
+  }
+  else {
+    CLONE->cumpv = _unur_xmalloc( DISTR.n_pv * sizeof(double) );
+    memcpy( CLONE->cumpv, GEN->cumpv, DISTR.n_pv * sizeof(double) );
+  }
   CLONE->guide_table = _unur_xmalloc( GEN->guide_size * sizeof(int) );
   memcpy( CLONE->guide_table, GEN->guide_table, GEN->guide_size * sizeof(int) );
 
@@ -594,12 +718,40 @@ _unur_dgt_free( struct unur_gen *gen )
   /* free two auxiliary tables */
   if (GEN->guide_table) free(GEN->guide_table);
   if (GEN->cumpv)       free(GEN->cumpv);
+  _unur_dgt_lazy_free_tables(gen);
 
   /* free memory */
   _unur_generic_free(gen);
 
 } /* end of _unur_dgt_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_dgt_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+
+  /* guide table */
+  if (GEN->guide_table) size += GEN->guide_size * sizeof(int);
+
+  /* table of cumulated probabilities */
+  if (GEN->cumpv) size += DISTR.n_pv * sizeof(double);
+
+  /* blocks of cumulated probabilities (lazy variant) */
+  if (GEN->cumblocks)
+    size += ( GEN->max_cumblocks * sizeof(double*)
+	      + GEN->n_cumblocks * DGT_LAZY_BLOCKSIZE * sizeof(double) );
+
+  return size;
+} /* end of _unur_dgt_memsize() */
+
 /*****************************************************************************/
 
 int
@@ -636,6 +788,35 @@ _unur_dgt_sample( struct unur_gen *gen )
 
 } /* end of _unur_dgt_sample() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dgt_lazy_sample( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* sample from generator (lazy variant)                                 */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   integer (sample from random variate)                               */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return INT_MAX                                                     */
+     /*----------------------------------------------------------------------*/
+{ 
+  int j;
+
+  /* check arguments */
+  CHECK_NULL(gen,INT_MAX);  COOKIE_CHECK(gen,CK_DGT_GEN,INT_MAX);
+
+  /* sample from U(0,1) and search */
+  j = _unur_dgt_lazy_lookup( gen, _unur_call_urng(gen->urng) );
+
+  return ((j < 0) ? INT_MAX : j + DISTR.domain[0]);
+
+} /* end of _unur_dgt_lazy_sample() */
+
 
 /*---------------------------------------------------------------------------*/
 
@@ -679,14 +860,27 @@ unur_dgt_eval_invcdf_recycle( const struct unur_gen *gen, double u, double *recy
     return INT_MAX;  /* u == NaN */
   }
 
-  /* look up in guide table ... */
-  j = GEN->guide_table[(int)(u * GEN->guide_size)];
-  /* ... and search */
-  u *= GEN->sum;
-  while (GEN->cumpv[j] < u) j++;
+  if (GEN->cumblocks != NULL) {
+    /* lazy variant: */
+    /* the tables are extended when required. thus we have to cast away 'const'. */
+    j = _unur_dgt_lazy_lookup( (struct unur_gen *) gen, u );
+    if (j < 0) return INT_MAX;
+    if (recycle) {
+      u *= GEN->sum;
+      *recycle = 1. - (CUMPV(j) - u) / (CUMPV(j) - ((j>0) ? CUMPV(j-1) : 0.));
+    }
+  }
 
-  if (recycle) {
-    *recycle = 1. - (GEN->cumpv[j] - u) / DISTR.pv[j];
+  else {
+    /* look up in guide table ... */
+    j = GEN->guide_table[(int)(u * GEN->guide_size)];
+    /* ... and search */
+    u *= GEN->sum;
+    while (GEN->cumpv[j] < u) j++;
+
+    if (recycle) {
+      *recycle = 1. - (GEN->cumpv[j] - u) / DISTR.pv[j];
+    }
   }
 
   j+=DISTR.domain[0];
@@ -737,6 +931,10 @@ _unur_dgt_create_tables( struct unur_gen *gen )
      /*   error code   ... on error                                          */
      /*----------------------------------------------------------------------*/
 { 
+  /* lazy variant */
+  if (GEN->lazy && DISTR.pv == NULL)
+    return _unur_dgt_lazy_create_tables(gen);
+
   /* size of guide table */
   GEN->guide_size = (int)( DISTR.n_pv * GEN->guide_factor);
   if (GEN->guide_size <= 0)
@@ -773,6 +971,10 @@ _unur_dgt_make_guidetable( struct unur_gen *gen )
   double pvh;                   /* aux variable for computing cumulated sums */
   double gstep;                 /* step size when computing guide table */
   int i,j;
+
+  /* lazy variant: guide table is computed on demand */
+  if (GEN->cumblocks != NULL)
+    return UNUR_SUCCESS;
   
   /* probability vector */
   pv = DISTR.pv;
@@ -827,6 +1029,280 @@ _unur_dgt_make_guidetable( struct unur_gen *gen )
 
 } /* end of _unur_dgt_make_guidetable() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dgt_lazy_create_tables( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* create (allocate) tables and compute first block (lazy variant).     */
+     /* the cumulated probabilities are stored in blocks of size             */
+     /* DGT_LAZY_BLOCKSIZE that are computed when sampling requires them.    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{ 
+  unsigned range;      /* range of domain */
+
+  /* remove old tables */
+  _unur_dgt_lazy_free_tables(gen);
+  if (GEN->cumpv) { free(GEN->cumpv); GEN->cumpv = NULL; }
+
+  /* index of last point in domain (we cannot handle more than INT_MAX points) */
+  range = (unsigned)DISTR.domain[1] - (unsigned)DISTR.domain[0];
+  GEN->n_last = (range < INT_MAX) ? (int) range : INT_MAX - 1;
+
+  /* size of guide table */
+  GEN->guide_size = (int)( _unur_min(GEN->n_last+1., (double)DGT_LAZY_MAXGUIDE) * GEN->guide_factor );
+  if (GEN->guide_size <= 0)
+    /* do not use a guide table whenever params->guide_factor is 0 or less */
+    GEN->guide_size = 1;
+  GEN->guide_table = _unur_xrealloc( GEN->guide_table, GEN->guide_size * sizeof(int) );
+
+  /* array of pointers to blocks */
+  GEN->max_cumblocks = 16;
+  GEN->cumblocks = _unur_xmalloc( GEN->max_cumblocks * sizeof(double*) );
+  GEN->n_cumblocks = 0;
+  GEN->n_cum = 0;
+  GEN->n_guide = 0;
+  GEN->complete = FALSE;
+
+  /* sum over PMF */
+  GEN->sum = DISTR.sum;
+
+  /* compute first entry of guide table (and thus first block) */
+  return _unur_dgt_lazy_extend(gen,0);
+
+} /* end of _unur_dgt_lazy_create_tables() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_dgt_lazy_free_tables( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* free blocks of cumulated probabilities (lazy variant)                */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{ 
+  int i;
+
+  if (GEN->cumblocks == NULL) return;
+
+  for (i=0; i<GEN->n_cumblocks; i++)
+    free(GEN->cumblocks[i]);
+  free(GEN->cumblocks);
+  GEN->cumblocks = NULL;
+  GEN->n_cumblocks = 0;
+  GEN->max_cumblocks = 0;
+  GEN->n_cum = 0;
+  GEN->n_guide = 0;
+
+} /* end of _unur_dgt_lazy_free_tables() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dgt_lazy_lookup( struct unur_gen *gen, double u )
+     /*----------------------------------------------------------------------*/
+     /* find index j with cumpv[j-1] < u*sum <= cumpv[j] (lazy variant).     */
+     /* entries of the guide table and blocks of cumulated probabilities     */
+     /* are computed when required.                                          */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   u   ... argument (0<=u<1)                                          */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   index j (starting at 0)                                            */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return -1                                                          */
+     /*----------------------------------------------------------------------*/
+{ 
+  int i,j;
+
+  /* entry in guide table */
+  i = (int)(u * GEN->guide_size);
+
+  /* compute missing entries */
+  if (i >= GEN->n_guide)
+    if (_unur_dgt_lazy_extend(gen,i) != UNUR_SUCCESS)
+      return -1;
+
+  /* compute missing blocks */
+  if (!GEN->complete && CUMPV(GEN->n_cum-1) < u * GEN->sum)
+    if (_unur_dgt_lazy_cover(gen,u * GEN->sum) != UNUR_SUCCESS)
+      return -1;
+  /* (the sum over the PMF may have been corrected meanwhile) */
+  u *= GEN->sum;
+
+  /* look up in guide table ... */
+  j = GEN->guide_table[i];
+  /* ... and search */
+  while (CUMPV(j) < u) j++;
+
+  return j;
+
+} /* end of _unur_dgt_lazy_lookup() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dgt_lazy_extend( struct unur_gen *gen, int i )
+     /*----------------------------------------------------------------------*/
+     /* compute entries of guide table up to index i (lazy variant).         */
+     /* the required blocks of cumulated probabilities are computed, too.    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   i   ... index of entry in guide table                              */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{ 
+  double thresh;       /* threshold for entry in guide table */
+  double sum;          /* sum over PMF (before computing new blocks) */
+  int j;
+
+  /* start with last computed entry */
+  j = (GEN->n_guide > 0) ? GEN->guide_table[GEN->n_guide-1] : 0;
+
+  for ( ; GEN->n_guide <= i; GEN->n_guide++) {
+    sum = GEN->sum;
+    thresh = sum * ((double)GEN->n_guide / GEN->guide_size);
+    if (_unur_dgt_lazy_cover(gen,thresh) != UNUR_SUCCESS)
+      return UNUR_ERR_GEN_DATA;
+    if (GEN->sum != sum) {
+      /* the sum over the PMF has been corrected and the entries of */
+      /* the guide table have been recomputed.                      */
+      thresh = GEN->sum * ((double)GEN->n_guide / GEN->guide_size);
+      j = (GEN->n_guide > 0) ? GEN->guide_table[GEN->n_guide-1] : 0;
+    }
+    while (CUMPV(j) < thresh) j++;
+    GEN->guide_table[GEN->n_guide] = j;
+  }
+
+  return UNUR_SUCCESS;
+
+} /* end of _unur_dgt_lazy_extend() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dgt_lazy_cover( struct unur_gen *gen, double thresh )
+     /*----------------------------------------------------------------------*/
+     /* compute blocks of cumulated probabilities until the last computed    */
+     /* value is at least 'thresh' (lazy variant).                           */
+     /* if the table is complete, then the last cumulated probability is     */
+     /* at least the sum over the PMF.                                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen    ... pointer to generator object                             */
+     /*   thresh ... threshold for cumulated probabilities                   */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{ 
+  while ( !GEN->complete && (GEN->n_cum == 0 || CUMPV(GEN->n_cum-1) < thresh) )
+    if (_unur_dgt_lazy_block(gen) != UNUR_SUCCESS)
+      return UNUR_ERR_GEN_DATA;
+
+  return UNUR_SUCCESS;
+} /* end of _unur_dgt_lazy_cover() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dgt_lazy_block( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute next block of cumulated probabilities (lazy variant).        */
+     /* the table is complete when the end of the domain is reached or when  */
+     /* the probability of the remaining tail is negligible. Then the last   */
+     /* point gets this remaining probability.                               */
+     /* If the cumulated probabilities cannot increase any more (in floating */
+     /* point arithmetic) although the PMF is positive, then the given sum   */
+     /* over the PMF is too large. Then it is replaced by the computed sum.  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{ 
+  double *block;       /* pointer to new block */
+  double pv, pvh;      /* probability and cumulated probabilities */
+  double pvh0;         /* cumulated probability before block */
+  int positive = FALSE; /* whether PMF is positive for some point in block */
+  int k;               /* first point in block */
+  int n;               /* number of points in block */
+  double thresh;       /* threshold for entry in guide table */
+  int i, j;
+
+  /* number of points in block */
+  n = _unur_min(DGT_LAZY_BLOCKSIZE, GEN->n_last - GEN->n_cum + 1);
+
+  /* allocate memory for block */
+  if (GEN->n_cumblocks >= GEN->max_cumblocks) {
+    GEN->max_cumblocks *= 2;
+    GEN->cumblocks = _unur_xrealloc( GEN->cumblocks, GEN->max_cumblocks * sizeof(double*) );
+  }
+  block = _unur_xmalloc( DGT_LAZY_BLOCKSIZE * sizeof(double) );
+
+  /* compute cumulated probabilities */
+  k = DISTR.domain[0] + GEN->n_cum;
+  pvh = pvh0 = (GEN->n_cum > 0) ? CUMPV(GEN->n_cum-1) : 0.;
+  for (i=0; i<n; i++) {
+    pv = _unur_discr_PMF(k+i,gen->distr);
+    /* ... and check probability vector */
+    if (! (pv >= 0.)) {
+      _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"probability < 0");
+      free(block);
+      return UNUR_ERR_GEN_DATA;
+    }
+    block[i] = ( pvh += pv );
+    if (pv > 0.) positive = TRUE;
+  }
+
+  /* store block */
+  GEN->cumblocks[GEN->n_cumblocks++] = block;
+  GEN->n_cum += n;
+
+  /* check whether we have reached the end of the table */
+  if (GEN->sum - pvh <= DGT_LAZY_TAIL * GEN->sum) {
+    GEN->complete = TRUE;
+    /* the last point gets the remaining probability (if any) */
+    if (pvh < GEN->sum) block[n-1] = GEN->sum;
+  }
+
+  else if (GEN->n_cum > GEN->n_last || (positive && _unur_FP_same(pvh,pvh0))) {
+    /* end of domain or sum cannot increase any more: */
+    /* the given sum over the PMF is too large.       */
+    _unur_warning(gen->genid,UNUR_ERR_GEN_DATA,"sum over PMF too large: use computed sum");
+    GEN->complete = TRUE;
+    GEN->sum = pvh;
+    /* recompute entries of guide table */
+    for (i=0, j=0; i < GEN->n_guide; i++) {
+      thresh = GEN->sum * ((double)i / GEN->guide_size);
+      while (CUMPV(j) < thresh) j++;
+      GEN->guide_table[i] = j;
+    }
+  }
+
+  return UNUR_SUCCESS;
+} /* end of _unur_dgt_lazy_block() */
+
 
 /*****************************************************************************/
 /**  Debugging utilities                                                    **/
@@ -862,10 +1338,19 @@ _unur_dgt_debug_init( struct unur_gen *gen )
 
   _unur_distr_discr_debug( gen->distr,gen->genid,(gen->debug & DGT_DEBUG_PRINTVECTOR));
 
-  fprintf(LOG,"%s: sampling routine = _unur_dgt_sample()\n",gen->genid);
-  fprintf(LOG,"%s:\n",gen->genid);
-
-  fprintf(LOG,"%s: length of probability vector = %d\n",gen->genid,DISTR.n_pv);
+  if (GEN->cumblocks != NULL) {
+    fprintf(LOG,"%s: sampling routine = _unur_dgt_lazy_sample()\n",gen->genid);
+    fprintf(LOG,"%s:\n",gen->genid);
+    fprintf(LOG,"%s: lazy variant: tables computed on demand in blocks of size %d\n",
+	    gen->genid,DGT_LAZY_BLOCKSIZE);
+    fprintf(LOG,"%s: number of points in domain = %d\n",gen->genid,GEN->n_last+1);
+    fprintf(LOG,"%s: number of points computed  = %d\n",gen->genid,GEN->n_cum);
+  }
+  else {
+    fprintf(LOG,"%s: sampling routine = _unur_dgt_sample()\n",gen->genid);
+    fprintf(LOG,"%s:\n",gen->genid);
+    fprintf(LOG,"%s: length of probability vector = %d\n",gen->genid,DISTR.n_pv);
+  }
   fprintf(LOG,"%s: length of guide table = %d   (rel. = %g%%",
 	  gen->genid,GEN->guide_size,100.*GEN->guide_factor);
   _unur_print_if_default(gen,DGT_SET_GUIDEFACTOR);
@@ -873,9 +1358,12 @@ _unur_dgt_debug_init( struct unur_gen *gen )
     fprintf(LOG,") \t (-->sequential search");
   fprintf(LOG,")\n%s:\n",gen->genid);
 
-  fprintf(LOG,"%s: sum over PMF (as computed) = %#-20.16g\n",gen->genid,GEN->sum);
+  if (GEN->cumblocks != NULL)
+    fprintf(LOG,"%s: sum over PMF (as given) = %#-20.16g\n",gen->genid,GEN->sum);
+  else
+    fprintf(LOG,"%s: sum over PMF (as computed) = %#-20.16g\n",gen->genid,GEN->sum);
 
-  if (gen->debug & DGT_DEBUG_TABLE)
+  if ((gen->debug & DGT_DEBUG_TABLE) && GEN->cumblocks == NULL)
     _unur_dgt_debug_table(gen);
 
 } /* end of _unur_dgt_debug_init() */
@@ -960,9 +1448,13 @@ _unur_dgt_info( struct unur_gen *gen, int help )
   /* distribution */
   _unur_string_append(info,"distribution:\n");
   _unur_distr_info_typename(gen);
-  _unur_string_append(info,"   functions = PV  [length=%d%s]\n",
-		      DISTR.domain[1]-DISTR.domain[0]+1,
-		      (DISTR.pmf==NULL) ? "" : ", created from PMF");
+  if (GEN->cumblocks != NULL)
+    _unur_string_append(info,"   functions = PMF  [computed on demand; %d of %d points]\n",
+			GEN->n_cum, GEN->n_last+1);
+  else
+    _unur_string_append(info,"   functions = PV  [length=%d%s]\n",
+			DISTR.domain[1]-DISTR.domain[0]+1,
+			(DISTR.pmf==NULL) ? "" : ", created from PMF");
   _unur_string_append(info,"   domain    = (%d, %d)\n", DISTR.domain[0],DISTR.domain[1]);
   _unur_string_append(info,"\n");
 
@@ -982,6 +1474,8 @@ _unur_dgt_info( struct unur_gen *gen, int help )
 			(gen->set & DGT_SET_GUIDEFACTOR) ? "" : "[default]");
     if (gen->set & DGT_SET_VARIANT)
       _unur_string_append(info,"   variant = %d\n", gen->variant);
+    if (gen->set & DGT_SET_LAZY)
+      _unur_string_append(info,"   lazy = %s\n", (GEN->lazy) ? "on" : "off");
     _unur_string_append(info,"\n");
   }
 
@@ -96,6 +96,11 @@
       domain of the distribution is trucated (see
       unur_distr_discr_make_pv() for details).
 
+      For distributions with huge domains (e.g. @unurmath{10^8} points)
+      the tables can be computed on demand (see unur_dgt_set_lazy()).
+      Then the cumulated probabilities are computed in blocks when
+      sampling requires them and the setup is (almost) free.
+
    =HOWTOUSE
       Create an object for a discrete distribution either by setting a
       probability vector or a PMF. The performance can be slightly
@@ -142,6 +147,32 @@ int unur_dgt_set_variant( UNUR_PAR *parameters, unsigned variant );
    vectors (@i{N}<1000) and variant @code{1} otherwise.
 */
 
+int unur_dgt_set_lazy( UNUR_PAR *parameters, int lazy );
+/* 
+   If @var{lazy} is TRUE, then the table of cumulated probabilities
+   is not computed during setup. Instead it is computed from the PMF
+   in blocks (of 1024 points) when the sampling routine requires
+   them. The guide table is computed on demand, too. Its size is
+   bounded by @unurmath{2^{20}} times the guide factor.
+   Thus the PMF is only evaluated in those regions of the domain
+   which are actually visited and the domain need not be truncated.
+   The tail of the distribution is chopped off when its probability
+   is less than @unurmath{10^{-12}} times the sum over the PMF.
+
+   This variant requires a PMF and the sum over the PMF (which must
+   be given accurately, see unur_distr_discr_set_pmfsum()).
+   If the given sum turns out to be too large (i.e., the end of the
+   domain is reached or the cumulated probabilities do not increase
+   any more), then a warning is issued and the computed sum is used
+   instead. Notice that random variates that have been generated
+   before are then drawn from a slightly distorted distribution.
+   It is ignored when the distribution object contains a PV.
+   Generator objects that use this variant cannot be shared by
+   sampling contexts (see unur_gen_share()).
+
+   Default is FALSE.
+*/
+
 /* =END */
 
 /*---------------------------------------------------------------------------*/
@@ -38,6 +38,7 @@
 struct unur_dgt_par { 
   double  guide_factor; /* relative length of guide table.  (DEFAULT = 1)    */
                         /*   length of guide table = guide_factor * len      */
+  int     lazy;         /* whether tables are computed on demand             */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -50,6 +51,16 @@ struct unur_dgt_gen {
   int     guide_size;   /* length of guide table                             */
   double  guide_factor; /* relative length of guide table.  (DEFAULT = 1)    */
                         /*   length of guide table = guide_factor * len      */
+  int     lazy;         /* whether tables are computed on demand             */
+
+  /* lazy variant: cumulated probabilities are computed in blocks on demand */
+  double **cumblocks;   /* array of blocks of cumulated probabilities        */
+  int     n_cumblocks;  /* number of computed blocks                         */
+  int     max_cumblocks;/* size of array of pointers to blocks               */
+  int     n_cum;        /* number of computed cumulated probabilities        */
+  int     n_last;       /* index of last point in domain                     */
+  int     n_guide;      /* number of computed entries in guide table         */
+  int     complete;     /* TRUE when remaining tail has been computed        */
 };
 
 /*---------------------------------------------------------------------------*/
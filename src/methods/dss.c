@@ -84,6 +84,13 @@
 /*---------------------------------------------------------------------------*/
 /* Flags for logging set calls                                               */
 
+#define DSS_SET_CACHE          0x001u     /* cache cumulated probabilities   */
+
+/*---------------------------------------------------------------------------*/
+/* Constants                                                                 */
+
+#define DSS_CACHE_BLOCK        (64)       /* minimal size of cache           */
+
 /*---------------------------------------------------------------------------*/
 
 #define GENTYPE "DSS"         /* type of generator                           */
@@ -120,11 +127,22 @@ static void _unur_dss_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_dss_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_dss_sample( struct unur_gen *gen );
+static int _unur_dss_sample_cache( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_dss_cache_extend( struct unur_gen *gen, double U );
+/*---------------------------------------------------------------------------*/
+/* extend cache of cumulated probabilities by sequential search              */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -160,7 +178,8 @@ static void _unur_dss_info( struct unur_gen *gen, int help );
 
 /*---------------------------------------------------------------------------*/
 
-#define _unur_dss_getSAMPLE(gen)   (_unur_dss_sample)
+#define _unur_dss_getSAMPLE(gen) \
+   ( (GEN->cache) ? _unur_dss_sample_cache : _unur_dss_sample )
 
 /*---------------------------------------------------------------------------*/
 
@@ -222,6 +241,8 @@ unur_dss_new( const struct unur_distr *distr )
 
   par->debug    = _unur_default_debugflag; /* set default debugging flags    */
 
+  PAR->cache = FALSE;                /* do not cache cumulated probabilities */
+
   /* routine for starting generator */
   par->init = _unur_dss_init;
 
@@ -229,6 +250,36 @@ unur_dss_new( const struct unur_distr *distr )
 
 } /* end of unur_dss_new() */
 
+/*****************************************************************************/
+
+int
+unur_dss_set_cache( struct unur_par *par, int cache )
+     /*----------------------------------------------------------------------*/
+     /* store cumulated probabilities that are computed during sampling      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par   ... pointer to parameter for building generator object       */
+     /*   cache ... 0 = sequential search, !0 = cache cumulated probabilities*/
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, DSS );
+
+  /* store date */
+  PAR->cache = (cache) ? TRUE : FALSE;
+
+  /* changelog */
+  par->set |= DSS_SET_CACHE;
+
+  return UNUR_SUCCESS;
+
+} /* end of unur_dss_set_cache() */
+
 
 /*****************************************************************************/
 /**  Private                                                                **/
@@ -297,6 +348,9 @@ _unur_dss_reinit( struct unur_gen *gen )
   /* (re)set sampling routine */
   SAMPLE = _unur_dss_getSAMPLE(gen);
 
+  /* cached values are not valid any more */
+  GEN->n_cumpv = 0;
+
 #ifdef UNUR_ENABLE_LOGGING
     /* write info into LOG file */
   if (gen->debug & DSS_DEBUG_REINIT) _unur_dss_debug_init(gen);
@@ -336,12 +390,21 @@ _unur_dss_create( struct unur_par *par )
   /* set generator identifier */
   gen->genid = _unur_set_genid(GENTYPE);
 
+  /* copy some parameters into generator object */
+  GEN->cache = PAR->cache;
+
   /* routines for sampling and destroying generator */
   SAMPLE = _unur_dss_getSAMPLE(gen);
   gen->destroy = _unur_dss_free;
   gen->clone = _unur_dss_clone;
+  gen->memsize = _unur_dss_memsize;
   gen->reinit = _unur_dss_reinit;
 
+  /* cache is allocated on demand */
+  GEN->cumpv = NULL;
+  GEN->n_cumpv = 0;
+  GEN->max_cumpv = 0;
+
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
   gen->info = _unur_dss_info;
@@ -425,6 +488,12 @@ _unur_dss_clone( const struct unur_gen *gen )
   /* create generic clone */
   clone = _unur_generic_clone( gen, GENTYPE );
 
+  /* copy cached cumulated probabilities */
+  if (GEN->cumpv) {
+    CLONE->cumpv = _unur_xmalloc( GEN->max_cumpv * sizeof(double) );
+    memcpy( CLONE->cumpv, GEN->cumpv, GEN->n_cumpv * sizeof(double) );
+  }
+
   return clone;
 
 #undef CLONE
@@ -456,10 +525,26 @@ _unur_dss_free( struct unur_gen *gen )
   SAMPLE = NULL;   /* make sure to show up a programming error */
 
   /* free memory */
+  if (GEN->cumpv) free(GEN->cumpv);
   _unur_generic_free(gen);
 
 } /* end of _unur_dss_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_dss_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  /* cache for cumulated probabilities */
+  return ((GEN->cumpv) ? GEN->max_cumpv * sizeof(double) : 0);
+} /* end of _unur_dss_memsize() */
+
 /*****************************************************************************/
 
 int
@@ -517,10 +602,137 @@ _unur_dss_sample( struct unur_gen *gen )
 
 } /* end of _unur_dss_sample() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_dss_sample_cache( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* sample from generator (cache cumulated probabilities)                */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   integer (sample from random variate)                               */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return INT_MAX                                                     */
+     /*----------------------------------------------------------------------*/
+{ 
+  double *cumpv;
+  double U;
+  int lo, hi, mid;
+
+  /* check arguments */
+  CHECK_NULL(gen,INT_MAX);  COOKIE_CHECK(gen,CK_DSS_GEN,INT_MAX);
+
+  U = _unur_call_urng(gen->urng);
+  if (gen->variant != DSS_VARIANT_CDF)
+    U *= DISTR.sum;
+
+  /* sequential search when U is not covered by cached values */
+  if (GEN->n_cumpv == 0 || GEN->cumpv[GEN->n_cumpv-1] < U)
+    return _unur_dss_cache_extend(gen,U);
+
+  cumpv = GEN->cumpv;
+
+  /* galloping search: find hi with cumpv[hi] >= U > cumpv[lo] */
+  lo = -1; hi = 0;
+  while (cumpv[hi] < U) {
+    lo = hi;
+    hi = 2*hi + 1;
+    if (hi >= GEN->n_cumpv) {
+      hi = GEN->n_cumpv - 1;
+      break;
+    }
+  }
+
+  /* binary search: smallest index hi with cumpv[hi] >= U */
+  while (hi - lo > 1) {
+    mid = lo + (hi - lo) / 2;
+    if (cumpv[mid] >= U) hi = mid;
+    else lo = mid;
+  }
+
+  return (hi + DISTR.domain[0]);
+
+} /* end of _unur_dss_sample_cache() */
+
 /*****************************************************************************/
 /**  Auxilliary Routines                                                    **/
 /*****************************************************************************/
 
+int
+_unur_dss_cache_extend( struct unur_gen *gen, double U )
+     /*----------------------------------------------------------------------*/
+     /* continue sequential search after the last cached value and store     */
+     /* all computed cumulated probabilities (or CDF values).                */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   U   ... (scaled) uniform random number                             */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   integer (sample from random variate)                               */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return INT_MAX                                                     */
+     /*----------------------------------------------------------------------*/
+{
+  double sum;
+  int J, n;
+
+  n = GEN->n_cumpv;
+  sum = (n > 0) ? GEN->cumpv[n-1] : 0.;
+
+  for (;;) {
+    /* domain exhausted (round-off errors): return last point */
+    if ( (gen->variant == DSS_VARIANT_PV)
+	 ? (n >= DISTR.n_pv)
+	 : (n > 0 && (unsigned) (n-1) >= (unsigned) DISTR.domain[1] - (unsigned) DISTR.domain[0]) )
+      return (n - 1 + DISTR.domain[0]);
+
+    /* next point of domain */
+    J = n + DISTR.domain[0];
+
+    /* enlarge cache */
+    if (n >= GEN->max_cumpv) {
+      /* size of cache must not exceed length of domain (and INT_MAX) */
+      /* (we use the index of the last point to avoid overflow) */
+      unsigned long n_last = (gen->variant == DSS_VARIANT_PV)
+	? (unsigned long) (DISTR.n_pv - 1)
+	: (unsigned long) ((unsigned) DISTR.domain[1] - (unsigned) DISTR.domain[0]);
+      unsigned long max_cumpv = (GEN->max_cumpv > 0)
+	? 2UL * (unsigned long) GEN->max_cumpv : (unsigned long) DSS_CACHE_BLOCK;
+      if (max_cumpv - 1UL > n_last) max_cumpv = n_last + 1UL;
+      if (max_cumpv > (unsigned long) INT_MAX) max_cumpv = (unsigned long) INT_MAX;
+      if (max_cumpv <= (unsigned long) n)
+	/* cannot enlarge cache any more: return last point */
+	return (n - 1 + DISTR.domain[0]);
+      GEN->max_cumpv = (int) max_cumpv;
+      GEN->cumpv = _unur_xrealloc( GEN->cumpv, GEN->max_cumpv * sizeof(double) );
+    }
+
+    switch(gen->variant) {
+    case DSS_VARIANT_PV:
+      sum += DISTR.pv[n];  break;
+    case DSS_VARIANT_PMF:
+      sum += PMF(J);       break;
+    case DSS_VARIANT_CDF:
+      sum = CDF(J);        break;
+    default:
+      _unur_error(gen->genid,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
+      return INT_MAX;
+    }
+
+    GEN->cumpv[n] = sum;
+    GEN->n_cumpv = ++n;
+
+    if (sum >= U) return J;
+  }
+
+} /* end of _unur_dss_cache_extend() */
+
 /*****************************************************************************/
 /**  Debugging utilities                                                    **/
 /*****************************************************************************/
@@ -551,7 +763,10 @@ _unur_dss_debug_init( struct unur_gen *gen )
 
   _unur_distr_discr_debug( gen->distr,gen->genid,(gen->debug & DSS_DEBUG_PRINTVECTOR));
 
-  fprintf(LOG,"%s: sampling routine = _unur_dss_sample()\n",gen->genid);
+  if (GEN->cache)
+    fprintf(LOG,"%s: sampling routine = _unur_dss_sample_cache()\n",gen->genid);
+  else
+    fprintf(LOG,"%s: sampling routine = _unur_dss_sample()\n",gen->genid);
   fprintf(LOG,"%s: variant = ",gen->genid);
   switch(gen->variant) {
   case DSS_VARIANT_PV:
@@ -611,15 +826,20 @@ _unur_dss_info( struct unur_gen *gen, int help )
 
   /* method */
   _unur_string_append(info,"method: DSS (Simple Sequential Search)\n");
+  if (GEN->cache)
+    _unur_string_append(info,"   cache cumulated probabilities  [%d cached]\n", GEN->n_cumpv);
   _unur_string_append(info,"\n");
 
   /* performance */
-  _unur_string_append(info,"performance characteristics: slow\n");
+  _unur_string_append(info,"performance characteristics: %s\n",
+		      (GEN->cache) ? "fast (after warm-up)" : "slow");
   _unur_string_append(info,"\n");
 
   /* parameters */
   if (help) {
-    _unur_string_append(info,"parameters: none\n");
+    _unur_string_append(info,"parameters:\n");
+    _unur_string_append(info,"   cache = %s  %s\n", (GEN->cache) ? "on" : "off",
+			(gen->set & DSS_SET_CACHE) ? "" : "[default]");
     _unur_string_append(info,"\n");
   }
 
@@ -74,6 +74,15 @@
       It uses actually uses the first one in this list (in this
       ordering) that could be found.
 
+      Optionally the cumulated probabilities (or CDF values) that are
+      computed during the sequential search can be stored
+      (see unur_dss_set_cache()). Then the search starts with a
+      galloping search followed by binary search in these cached
+      values and the sequential search is only used when the
+      required cumulated probability has not been computed yet.
+      Thus there is still no setup but sampling becomes much faster
+      when many random variates are required.
+
    =HOWTOUSE
       It works with a discrete distribution object with contains at
       least the PV, the PMF, or the CDF. 
@@ -94,6 +103,19 @@ UNUR_PAR *unur_dss_new( const UNUR_DISTR *distribution );
    Get default parameters for generator.
 */
 
+/*...........................................................................*/
+
+int unur_dss_set_cache( UNUR_PAR *parameters, int cache );
+/*
+   If @var{cache} is TRUE, then the cumulated probabilities (or CDF
+   values) are stored when they are computed during sampling.
+   The array of cached values grows until it covers the largest
+   random variate that has been generated so far.
+   Notice that the generator object is then modified during sampling.
+
+   Default is FALSE.
+*/
+
 /* =END */
 
 /*---------------------------------------------------------------------------*/
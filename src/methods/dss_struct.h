@@ -36,14 +36,17 @@
 /* Information for constructing the generator                                */
 
 struct unur_dss_par { 
-  int dummy;
+  int     cache;        /* whether cumulated probabilities are cached        */
 };
 
 /*---------------------------------------------------------------------------*/
 /* The generator object                                                      */
 
 struct unur_dss_gen { 
-  int dummy;
+  int     cache;        /* whether cumulated probabilities are cached        */
+  double *cumpv;        /* cached cumulated probabilities (or CDF values)    */
+  int     n_cumpv;      /* number of cached values                           */
+  int     max_cumpv;    /* size of array cumpv                               */
 };
 
 /*---------------------------------------------------------------------------*/
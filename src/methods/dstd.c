@@ -145,6 +145,11 @@ static void _unur_dstd_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_dstd_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 /*---------------------------------------------------------------------------*/
 /* There are no sampling routines, since every distribution has its own.     */
 /* Sampling routines are defined in ../distributions/ for each distributions.*/
@@ -332,6 +337,7 @@ unur_dstd_chg_truncated( struct unur_gen *gen, int left, int right )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, DSTD, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* domain can only be changed for inversion method! */
   if ( ! GEN->is_inversion ) { 
@@ -544,6 +550,7 @@ _unur_dstd_create( struct unur_par *par )
   SAMPLE = NULL;    /* will be set in _unur_dstd_init() */
   gen->destroy = _unur_dstd_free;
   gen->clone = _unur_dstd_clone;
+  gen->memsize = _unur_dstd_memsize;
   gen->reinit = _unur_dstd_reinit;
 
   /* defaults */
@@ -689,6 +696,26 @@ _unur_dstd_free( struct unur_gen *gen )
   _unur_generic_free(gen);
 } /* end of _unur_dstd_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_dstd_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+
+  /* parameters for special generator */
+  if (GEN->gen_param)  size += GEN->n_gen_param * sizeof(double);
+  if (GEN->gen_iparam) size += GEN->n_gen_iparam * sizeof(int);
+
+  return size;
+} /* end of _unur_dstd_memsize() */
+
 /*****************************************************************************/
 
 /** 
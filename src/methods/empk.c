@@ -182,6 +182,8 @@
 
 #define EMPK_VARFLAG_VARCOR     0x001u   /* use variance correction          */
 #define EMPK_VARFLAG_POSITIVE   0x002u   /* only positive values             */
+#define EMPK_VARFLAG_REPRODUCE  0x004u   /* sampling arrays reproduces
+					    sequence of scalar sampling      */
 
 /*---------------------------------------------------------------------------*/
 /* Debugging flags                                                           */
@@ -201,6 +203,7 @@
 #define EMPK_SET_ALPHA          0x002u    /* alpha factor                    */
 #define EMPK_SET_BETA           0x004u    /* beta factor                     */
 #define EMPK_SET_SMOOTHING      0x008u    /* smoothing factor                */
+#define EMPK_SET_REPRODUCIBLE   0x040u    /* reproducible array sampling     */
 
 /*---------------------------------------------------------------------------*/
 
@@ -233,17 +236,33 @@ static double _unur_empk_sample( struct unur_gen *gen );
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
-inline static int _unur_empk_comp_stddev( double *data, int n_data,
+static int _unur_empk_sample_array( struct unur_gen *gen, double *X, int n );
+/*---------------------------------------------------------------------------*/
+/* sample array of random variates from generator                            */
+/*---------------------------------------------------------------------------*/
+
+inline static int _unur_empk_comp_stddev( const double *data, int n_data,
 					  double *mean, double *stddev);
 /*---------------------------------------------------------------------------*/
 /* compute mean and standard deviation of data.                              */
 /*---------------------------------------------------------------------------*/
 
-inline static double _unur_empk_comp_iqrtrange( double *data, int n_data );
+static double _unur_empk_comp_iqrtrange( const double *data, int n_data );
 /*---------------------------------------------------------------------------*/
 /* compute interquartile range.                                              */
 /*---------------------------------------------------------------------------*/
 
+static double _unur_empk_comp_orderstat( const double *data, int n_data, int k,
+					 double xmin, double xmax );
+/*---------------------------------------------------------------------------*/
+/* compute k-th order statistic of (unsorted) data.                          */
+/*---------------------------------------------------------------------------*/
+
+static double _unur_empk_select( double *data, int n_data, int k );
+/*---------------------------------------------------------------------------*/
+/* find k-th smallest element of array (array is reordered).                 */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -273,28 +292,31 @@ static void _unur_empk_info( struct unur_gen *gen, int help );
 #define DISTR     gen->distr->data.cemp /* data for distribution in generator object */
 
 #define SAMPLE    gen->sample.cont      /* pointer to sampling routine       */     
+#define SAMPLE_ARRAY  gen->sample_array.cont  /* pointer to routine for arrays */
 
 /*---------------------------------------------------------------------------*/
 /* constants                                                                 */
 
-/*---------------------------------------------------------------------------*/
+#define EMPK_OSTAT_BINS   (1024)
+/* number of bins used for narrowing the range that contains the            */
+/* requested order statistic in a single pass through the data.             */
 
-#define SQU(a) ((a)*(a))
+#define EMPK_OSTAT_BUFSIZE  (8192)
+/* maximal number of observations that are copied into a buffer for         */
+/* finding the order statistic by selection.                                */
+
+#define EMPK_BLOCKSIZE  (256)
+/* number of random variates that are generated in one block when an array  */
+/* of random variates is requested.                                         */
 
 /*---------------------------------------------------------------------------*/
 
-/* compare two doubles (needed for sorting) */
-inline static int 
-compare_doubles (const void *a, const void *b)
-{ 
-  const double *da = (const double *) a;
-  const double *db = (const double *) b;
-  return (*da > *db) - (*da < *db);
-}
+#define SQU(a) ((a)*(a))
 
 /*---------------------------------------------------------------------------*/
 
 #define _unur_empk_getSAMPLE(gen)   (_unur_empk_sample)
+#define _unur_empk_getSAMPLE_ARRAY(gen)   (_unur_empk_sample_array)
 
 /*---------------------------------------------------------------------------*/
 
@@ -758,6 +780,43 @@ unur_empk_set_positive( struct unur_par *par, int positive )
 
 } /* end of unur_empk_set_positive() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+unur_empk_set_reproducible( struct unur_par *par, int reproducible )
+     /*----------------------------------------------------------------------*/
+     /* whether unur_sample_cont_array() reproduces the sequence of          */
+     /* random variates generated by repeated unur_sample_cont() calls       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par          ... pointer to parameter for building generator obj.  */
+     /*   reproducible ... 0 = faster block sampling, !0 = same sequence     */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   block sampling is the default                                      */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, EMPK );
+
+  /* we use a bit in variant */
+  par->variant = (reproducible) 
+    ? (par->variant | EMPK_VARFLAG_REPRODUCE) 
+    : (par->variant & (~EMPK_VARFLAG_REPRODUCE));
+
+  /* changelog */
+  par->set |= EMPK_SET_REPRODUCIBLE;
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+
+} /* end of unur_empk_set_reproducible() */
+
 
 /*****************************************************************************/
 /**  Private                                                                **/
@@ -819,12 +878,9 @@ _unur_empk_init( struct unur_par *par )
   /* copy debugging flags */
   GEN->kerngen->debug = par->debug;
 
-  /* the observed data */
-
-  /* sort entries */
-  /** TODO: this sort can be removed after we have implemented a new 
-      version of the function iqrtrange, that does not depend on sorting **/
-  qsort( GEN->observ, (size_t)GEN->n_observ, sizeof(double), compare_doubles);
+  /* the observed data.                                           */
+  /* we neither sort nor copy the observed data. Thus the sample   */
+  /* may also be a (read-only) array that is owned by the caller.  */
 
   /* compute mean and standard deviation of observed sample */
   _unur_empk_comp_stddev( GEN->observ, GEN->n_observ, &(GEN->mean_observ), &(GEN->stddev_observ) );
@@ -892,6 +948,7 @@ _unur_empk_create( struct unur_par *par )
 
   /* routines for sampling and destroying generator */
   SAMPLE = _unur_empk_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_empk_getSAMPLE_ARRAY(gen);
   gen->destroy = _unur_empk_free;
   gen->clone = _unur_empk_clone;
 
@@ -991,6 +1048,7 @@ _unur_empk_free( struct unur_gen *gen )
 
   /* we cannot use this generator object any more */
   SAMPLE = NULL;   /* make sure to show up a programming error */
+  SAMPLE_ARRAY = NULL;
 
   /* free memory */
   _unur_generic_free(gen);
@@ -1046,13 +1104,90 @@ _unur_empk_sample( struct unur_gen *gen )
 
 } /* end of _unur_empk_sample() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_empk_sample_array( struct unur_gen *gen, double *X, int n )
+     /*----------------------------------------------------------------------*/
+     /* sample array of random variates from generator                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   X   ... pointer to array for storing random variates               */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   Random variates are generated in blocks of size EMPK_BLOCKSIZE.    */
+     /*   By default we first draw all indices of a block and then all       */
+     /*   kernel variates by a single call to the array routine of the       */
+     /*   kernel generator. Thus the resulting sequence differs from that    */
+     /*   of repeated _unur_empk_sample() calls.                             */
+     /*   If variant EMPK_VARFLAG_REPRODUCE is set, then index and kernel    */
+     /*   variate are drawn alternately as in _unur_empk_sample().           */
+     /*----------------------------------------------------------------------*/
+{ 
+  double K[EMPK_BLOCKSIZE];   /* kernel variates */
+  int J[EMPK_BLOCKSIZE];      /* indices of selected observations */
+  double *Y;                  /* pointer into array X */
+  int i, m;
+  int status;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_EMPK_GEN,UNUR_ERR_COOKIE);
+
+  for ( ; n > 0; n -= m, X += m) {
+
+    /* size of next block */
+    m = (n < EMPK_BLOCKSIZE) ? n : EMPK_BLOCKSIZE;
+
+    if (gen->variant & EMPK_VARFLAG_REPRODUCE) {
+      /* same order of uniform random numbers as in _unur_empk_sample() */
+      for (i=0; i<m; i++) {
+	J[i] = (int) (_unur_call_urng(gen->urng) * GEN->n_observ);
+	K[i] = unur_sample_cont( GEN->kerngen );
+      }
+    }
+    else {
+      /* select uniformly observations */
+      for (i=0; i<m; i++)
+	J[i] = (int) (_unur_call_urng(gen->urng) * GEN->n_observ);
+      /* sample from kernel distribution */
+      status = unur_sample_cont_array( GEN->kerngen, K, m );
+      if (status != UNUR_SUCCESS) return status;
+    }
+
+    /* add noise */
+    Y = X;
+    if (gen->variant & EMPK_VARFLAG_VARCOR)
+      /* use variance correction */
+      for (i=0; i<m; i++)
+	Y[i] = GEN->mean_observ + (GEN->observ[J[i]] - GEN->mean_observ + GEN->bwidth * K[i]) * GEN->sconst;
+    else
+      /* no variance correction */
+      for (i=0; i<m; i++)
+	Y[i] = GEN->observ[J[i]] + GEN->bwidth * K[i];
+
+    if (gen->variant & EMPK_VARFLAG_POSITIVE)
+      /* use mirroring to avoid non-positive numbers */
+      for (i=0; i<m; i++)
+	Y[i] = (Y[i]<0.) ? -Y[i] : Y[i];
+  }
+
+  return UNUR_SUCCESS;
+
+} /* end of _unur_empk_sample_array() */
+
 
 /*****************************************************************************/
 /**  Auxilliary Routines                                                    **/
 /*****************************************************************************/
 
 int
-_unur_empk_comp_stddev( double *data, int n_data, double *mean, double *stddev)
+_unur_empk_comp_stddev( const double *data, int n_data, double *mean, double *stddev)
      /*----------------------------------------------------------------------*/
      /* compute mean and standard deviation of data                          */
      /*                                                                      */
@@ -1099,12 +1234,10 @@ _unur_empk_comp_stddev( double *data, int n_data, double *mean, double *stddev)
 
 /*---------------------------------------------------------------------------*/
 
-/** TODO: implement a new version of interquartilsrang that does not depend
-    on sorting. (Only important if we want to use really large samples) **/
 double
-_unur_empk_comp_iqrtrange( double *data, int n )
+_unur_empk_comp_iqrtrange( const double *data, int n )
      /*----------------------------------------------------------------------*/
-     /* compute interquartile range of sorted data (in ascending order)      */
+     /* compute interquartile range of data.                                 */
      /*                                                                      */
      /* parameters:                                                          */
      /*   data   ... pointer to array of data                                */
@@ -1112,28 +1245,206 @@ _unur_empk_comp_iqrtrange( double *data, int n )
      /*                                                                      */
      /* return:                                                              */
      /*   interquartile range                                                */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   The data need not be sorted and are not modified. The required     */
+     /*   order statistics are computed by selection in O(n) time using      */
+     /*   only a small amount of additional memory.                          */
      /*----------------------------------------------------------------------*/
 {
   double lowerqrt,upperqrt;  /* lower and upper quartile */
-  int j;
-
-  /* data must be sorted in ascending order */
+  double xmin, xmax;         /* minimum and maximum of data */
+  int i,j;
+
+  /* range of data */
+  xmin = xmax = data[0];
+  for (i=1; i<n; i++) {
+    if (data[i] < xmin) xmin = data[i];
+    if (data[i] > xmax) xmax = data[i];
+  }
 
   j = n/2;
 
   if (j % 2) {
-    lowerqrt = data[(j+1)/2-1];
-    upperqrt = data[n-(j+1)/2];
+    lowerqrt = _unur_empk_comp_orderstat(data,n,(j+1)/2-1,xmin,xmax);
+    upperqrt = _unur_empk_comp_orderstat(data,n,n-(j+1)/2,xmin,xmax);
   }
   else {
-    lowerqrt = (data[j/2-1] + data[j/2+1-1])/2.;
-    upperqrt = (data[n-j/2] + data[n-j/2-1])/2.;
+    lowerqrt = ( _unur_empk_comp_orderstat(data,n,j/2-1,xmin,xmax) +
+		 _unur_empk_comp_orderstat(data,n,j/2,xmin,xmax) ) / 2.;
+    upperqrt = ( _unur_empk_comp_orderstat(data,n,n-j/2,xmin,xmax) +
+		 _unur_empk_comp_orderstat(data,n,n-j/2-1,xmin,xmax) ) / 2.;
   }
   
   return (upperqrt - lowerqrt);
 
 } /* end of _unur_empk_comp_iqrange() */
 
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_empk_comp_orderstat( const double *data, int n, int k, double xmin, double xmax )
+     /*----------------------------------------------------------------------*/
+     /* compute k-th order statistic of data, i.e., the element that would   */
+     /* be stored at position k (starting at 0) after sorting the data.      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   data   ... pointer to array of data                                */
+     /*   n      ... number of data points                                   */
+     /*   k      ... index of order statistic (0 <= k < n)                   */
+     /*   xmin   ... minimum of data                                         */
+     /*   xmax   ... maximum of data                                         */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   k-th order statistic                                               */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   The data are not modified.                                         */
+     /*   We keep an interval [lo,hi] (or [lo,hi)) that contains the         */
+     /*   requested element and count the number of observations in each    */
+     /*   of EMPK_OSTAT_BINS subintervals. Then we continue with the         */
+     /*   subinterval that contains the order statistic until it contains    */
+     /*   at most EMPK_OSTAT_BUFSIZE observations. These are copied into a   */
+     /*   buffer where the element is found by selection.                    */
+     /*   Bin boundaries are stored explicitly and all comparisons are made  */
+     /*   with these boundaries. Thus the counts are exact.                  */
+     /*----------------------------------------------------------------------*/
+{
+  double lo, hi;      /* boundaries of interval that contains order statistic */
+  int closed;         /* whether hi belongs to the interval */
+  int n_below;        /* number of observations less than lo */
+  int n_in;           /* number of observations in interval */
+  double *edge;       /* boundaries of bins */
+  int *count;         /* number of observations in bins */
+  double *buf;        /* buffer for selection */
+  double x, result;
+  int i, b, n_buf;
+
+  /* check arguments */
+  CHECK_NULL(data,UNUR_INFINITY);
+  if (k < 0 || k >= n) {
+    _unur_error(GENTYPE,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
+    return UNUR_INFINITY;
+  }
+
+  /* allocate working arrays */
+  edge  = _unur_xmalloc( (EMPK_OSTAT_BINS+1) * sizeof(double) );
+  count = _unur_xmalloc( EMPK_OSTAT_BINS * sizeof(int) );
+  buf   = _unur_xmalloc( EMPK_OSTAT_BUFSIZE * sizeof(double) );
+
+  /* start with whole range of data */
+  lo = xmin; hi = xmax; closed = TRUE;
+  n_below = 0; n_in = n;
+
+  while (n_in > EMPK_OSTAT_BUFSIZE) {
+
+    /* compute boundaries of bins */
+    for (b=0; b<EMPK_OSTAT_BINS; b++)
+      edge[b] = lo + b * ((hi - lo) / EMPK_OSTAT_BINS);
+    edge[EMPK_OSTAT_BINS] = hi;
+
+    /* count observations in bins */
+    for (b=0; b<EMPK_OSTAT_BINS; b++) count[b] = 0;
+    for (i=0; i<n; i++) {
+      x = data[i];
+      if (x < lo || x > hi || (x == hi && !closed)) continue;
+      /* first guess for bin ... */
+      b = (hi > lo) ? (int) ((x - lo) / (hi - lo) * EMPK_OSTAT_BINS) : 0;
+      if (b < 0) b = 0;
+      if (b >= EMPK_OSTAT_BINS) b = EMPK_OSTAT_BINS-1;
+      /* ... and correct it using the stored boundaries */
+      while (b > 0 && x < edge[b]) --b;
+      while (b < EMPK_OSTAT_BINS-1 && x >= edge[b+1]) ++b;
+      ++count[b];
+    }
+
+    /* find bin that contains the order statistic */
+    for (b=0; b<EMPK_OSTAT_BINS-1; b++) {
+      if (k < n_below + count[b]) break;
+      n_below += count[b];
+    }
+
+    if (edge[b] == lo && edge[b+1] == hi) {
+      /* we cannot split the interval any more, i.e., there is no */
+      /* floating point number between lo and hi.                 */
+      if (closed) {
+	/* count number of observations equal to lo */
+	for (n_buf=0, i=0; i<n; i++)
+	  if (data[i] == lo) ++n_buf;
+	result = (k < n_below + n_buf) ? lo : hi;
+      }
+      else
+	result = lo;
+      free(edge); free(count); free(buf);
+      return result;
+    }
+
+    /* continue with this bin */
+    n_in = count[b];
+    closed = (b == EMPK_OSTAT_BINS-1) ? closed : FALSE;
+    lo = edge[b];
+    hi = edge[b+1];
+  }
+
+  /* copy observations in interval into buffer */
+  for (n_buf=0, i=0; i<n; i++) {
+    x = data[i];
+    if (x < lo || x > hi || (x == hi && !closed)) continue;
+    buf[n_buf++] = x;
+  }
+
+  /* find element by selection */
+  result = _unur_empk_select( buf, n_buf, k - n_below );
+
+  free(edge); free(count); free(buf);
+  return result;
+
+} /* end of _unur_empk_comp_orderstat() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_empk_select( double *data, int n, int k )
+     /*----------------------------------------------------------------------*/
+     /* find k-th smallest element (starting at 0) in array.                 */
+     /* The array is reordered (Hoare's FIND algorithm).                     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   data   ... pointer to array of data                                */
+     /*   n      ... number of data points                                   */
+     /*   k      ... index of element (0 <= k < n)                           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   k-th smallest element                                              */
+     /*----------------------------------------------------------------------*/
+{
+  int left, right;   /* boundaries of subarray that contains element */
+  int i, j;
+  double pivot, tmp;
+
+  left = 0;
+  right = n-1;
+
+  while (left < right) {
+    pivot = data[k];
+    i = left;
+    j = right;
+    do {
+      while (data[i] < pivot) i++;
+      while (pivot < data[j]) j--;
+      if (i <= j) {
+	tmp = data[i]; data[i] = data[j]; data[j] = tmp;
+	i++; j--;
+      }
+    } while (i <= j);
+    if (j < k) left = i;
+    if (k < i) right = j;
+  }
+
+  return data[k];
+
+} /* end of _unur_empk_select() */
+
 /*****************************************************************************/
 /**  Debugging utilities                                                    **/
 /*****************************************************************************/
@@ -1166,7 +1477,10 @@ _unur_empk_debug_init( const struct unur_gen *gen )
   _unur_distr_cemp_debug( gen->distr, gen->genid, (gen->debug & EMPK_DEBUG_PRINTDATA));
 
   fprintf(LOG,"%s: sampling routine = _unur_empk_sample()\n",gen->genid);
-  fprintf(LOG,"%s:\n",gen->genid);
+  fprintf(LOG,"%s: sampling routine for arrays = _unur_empk_sample_array()",gen->genid);
+  if (gen->variant & EMPK_VARFLAG_REPRODUCE)
+    fprintf(LOG,"  [reproduces sequence of scalar sampling]");
+  fprintf(LOG,"\n%s:\n",gen->genid);
 
   fprintf(LOG,"%s: smoothing factor = %g",gen->genid, GEN->smoothing);
   _unur_print_if_default(gen,EMPK_SET_SMOOTHING); fprintf(LOG,"\n");
@@ -1287,6 +1601,9 @@ _unur_empk_info( struct unur_gen *gen, int help )
     if (gen->variant & EMPK_VARFLAG_POSITIVE) 
       _unur_string_append(info,"   positive = on\n");
 
+    if (gen->variant & EMPK_VARFLAG_REPRODUCE) 
+      _unur_string_append(info,"   reproducible = on\n");
+
     _unur_string_append(info,"\n");
 
     /* Not displayed:
@@ -42,7 +42,7 @@
 
    =REQUIRED observed sample
 
-   =SPEED Set-up: slow (as sample is sorted),
+   =SPEED Set-up: fast (linear in sample size),
           Sampling: fast (depends on kernel)
 
    =REINIT not implemented
@@ -87,6 +87,12 @@
       Additionally variance correction and a correction for
       non-negative variates can be switched on.
 
+      The observed sample is neither sorted nor modified during setup.
+      Thus for huge samples the data can be passed to the
+      distribution object by means of unur_distr_cemp_set_data_ref()
+      which avoids copying the data. Then the sample is shared between
+      the distribution object and all generator objects.
+
       The two other parameters (smoothing factor and beta factor) are
       only useful for people knowing the theory of kernel density
       estimation. It is not necessary to change them if 
@@ -259,6 +265,23 @@ int unur_empk_set_positive( UNUR_PAR *parameters, int positive );
    Default is FALSE.
 */
 
+int unur_empk_set_reproducible( UNUR_PAR *parameters, int reproducible );
+/* 
+   EMPK implements a special routine for unur_sample_cont_array()
+   which generates the random variates in blocks. By default, all
+   indices of the selected observations of a block are drawn first and
+   then all kernel variates, using the array routine of the kernel
+   generator. Thus the resulting sequence of random variates differs
+   from the sequence obtained by repeated unur_sample_cont() calls.
+
+   If @var{reproducible} is TRUE then unur_sample_cont_array()
+   returns exactly the same sequence as repeated calls to
+   unur_sample_cont() (with the same state of the uniform random
+   number generator). This is slightly slower.
+
+   Default is FALSE.
+*/
+
 /* =END */
 
 /*---------------------------------------------------------------------------*/
@@ -106,6 +106,11 @@ static void _unur_empl_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_empl_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_empl_sample( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
@@ -305,10 +310,18 @@ _unur_empl_create( struct unur_par *par )
   SAMPLE = _unur_empl_getSAMPLE(gen);
   gen->destroy = _unur_empl_free;
   gen->clone = _unur_empl_clone;
+  gen->memsize = _unur_empl_memsize;
 
   /* copy observed data into generator object */
-  GEN->observ   = DISTR.sample;          /* observations in distribution object */
   GEN->n_observ = DISTR.n_sample;        /* sample size */
+  if (DISTR.sample_is_ref) {
+    /* the sample is owned by the caller and must not be modified. */
+    /* thus we need a private copy which we can sort.              */
+    GEN->observ = _unur_xmalloc( GEN->n_observ * sizeof(double) );
+    memcpy( GEN->observ, DISTR.sample, GEN->n_observ * sizeof(double) );
+  }
+  else
+    GEN->observ = DISTR.sample;          /* observations in distribution object */
 
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
@@ -348,7 +361,13 @@ _unur_empl_clone( const struct unur_gen *gen )
   clone = _unur_generic_clone( gen, GENTYPE );
 
   /* copy observed data into generator object */
-  CLONE->observ = clone->distr->data.cemp.sample;   /* observations in distribution object */
+  if (clone->distr->data.cemp.sample_is_ref) {
+    /* private copy of sorted sample */
+    CLONE->observ = _unur_xmalloc( GEN->n_observ * sizeof(double) );
+    memcpy( CLONE->observ, GEN->observ, GEN->n_observ * sizeof(double) );
+  }
+  else
+    CLONE->observ = clone->distr->data.cemp.sample;   /* observations in distribution object */
 
   return clone;
 
@@ -380,11 +399,31 @@ _unur_empl_free( struct unur_gen *gen )
   /* we cannot use this generator object any more */
   SAMPLE = NULL;   /* make sure to show up a programming error */
 
+  /* free private copy of sample */
+  if (DISTR.sample_is_ref && GEN->observ) free(GEN->observ);
+
   /* free memory */
   _unur_generic_free(gen);
 
 } /* end of _unur_empl_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_empl_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  /* sorted copy of observations */
+  /* (unless the sample is stored in the distribution object) */
+  return ((GEN->observ && GEN->observ != DISTR.sample) 
+	  ? GEN->n_observ * sizeof(double) : 0);
+} /* end of _unur_empl_memsize() */
+
 /*****************************************************************************/
 
 double
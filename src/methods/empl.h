@@ -76,6 +76,10 @@
       interpolation of the empirical CDF. There are no parameters to
       set.
 
+      If the sample is given by reference (see
+      unur_distr_cemp_set_data_ref()), then the generator object
+      stores its own sorted copy of the data.
+
       @noindent
       @emph{Important}: We do not recommend to use this method! Use
       method EMPK
@@ -69,6 +69,13 @@
 #  include <tests/unuran_tests.h>
 #endif
 
+/*---------------------------------------------------------------------------*/
+/* Constants                                                                 */
+
+/* Maximal number of construction points of the hat for the conditional      */
+/* distribution that are retained for the next step (warm start).            */
+#define GIBBS_WARMSTART_NCPOINTS  (2)
+
 /*---------------------------------------------------------------------------*/
 /* Variants                                                                  */
 
@@ -81,6 +88,8 @@
 #define GIBBS_VAR_T_LOG           0x0020u    /* T(x) = log(x)                */
 #define GIBBS_VAR_T_POW           0x0030u    /* T(x) = -x^c                  */
 
+#define GIBBS_VARFLAG_WARMSTART   0x0100u    /* reuse hat of conditional distr. */
+
 /*---------------------------------------------------------------------------*/
 /* Debugging flags                                                           */
 /*    bit  01    ... pameters and structure of generator (do not use here)   */
@@ -97,6 +106,7 @@
 #define GIBBS_SET_X0         0x002u    /* set starting point                 */
 #define GIBBS_SET_THINNING   0x004u    /* set thinning factor                */
 #define GIBBS_SET_BURNIN     0x008u    /* set length of burn-in              */
+#define GIBBS_SET_WARMSTART  0x010u    /* set warm start for conditionals    */
 
 /*---------------------------------------------------------------------------*/
 
@@ -487,6 +497,39 @@ unur_gibbs_set_burnin( struct unur_par *par, int burnin )
 
 /*---------------------------------------------------------------------------*/
 
+int
+unur_gibbs_set_warmstart( struct unur_par *par, int warmstart )
+     /*----------------------------------------------------------------------*/
+     /* reuse hat for conditional distribution of last step (warm start)     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par       ... pointer to parameter for building generator object   */
+     /*   warmstart ... 0 = disable,  !0 = enable                            */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, GIBBS );
+
+  /* we use a bit in variant */
+  par->variant = (warmstart) 
+    ? (par->variant | GIBBS_VARFLAG_WARMSTART) 
+    : (par->variant & (~GIBBS_VARFLAG_WARMSTART));
+
+  /* changelog */
+  par->set |= GIBBS_SET_WARMSTART;
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+
+} /* end of unur_gibbs_set_warmstart() */
+
+/*---------------------------------------------------------------------------*/
+
 const double *
 unur_gibbs_get_state( struct unur_gen *gen )
      /*----------------------------------------------------------------------*/
@@ -700,6 +743,8 @@ _unur_gibbs_coord_init( struct unur_gen *gen )
       /* use more robust method ARS for T = log */
       par_condi = unur_ars_new(GEN->distr_condi);
       unur_ars_set_reinit_percentiles(par_condi,2,NULL);
+      if (gen->variant & GIBBS_VARFLAG_WARMSTART)
+	unur_ars_set_reinit_warmstart(par_condi,GIBBS_WARMSTART_NCPOINTS);
       break;
       
     case GIBBS_VAR_T_SQRT:
@@ -786,6 +831,8 @@ _unur_gibbs_randomdir_init( struct unur_gen *gen )
     /* use more robust method ARS for T = log */
     par_condi = unur_ars_new(GEN->distr_condi);
     unur_ars_set_reinit_percentiles(par_condi,2,NULL);
+    if (gen->variant & GIBBS_VARFLAG_WARMSTART)
+      unur_ars_set_reinit_warmstart(par_condi,GIBBS_WARMSTART_NCPOINTS);
     break;
 
   case GIBBS_VAR_T_SQRT:
@@ -872,6 +919,13 @@ _unur_gibbs_create( struct unur_par *par )
   else
     par->variant = (par->variant & (~GIBBS_VARMASK_T)) | GIBBS_VAR_T_POW;
 
+  /* warm start is only implemented for T = log (method ARS) */
+  if ( (par->variant & GIBBS_VARFLAG_WARMSTART) &&
+       (par->variant & GIBBS_VARMASK_T) != GIBBS_VAR_T_LOG ) {
+    _unur_warning(gen->genid,UNUR_ERR_GEN_DATA,"warm start requires c = 0. ignored");
+    par->variant &= ~GIBBS_VARFLAG_WARMSTART;
+  }
+
   /* routines for sampling and destroying generator */
   SAMPLE = _unur_gibbs_getSAMPLE(gen);
   gen->destroy = _unur_gibbs_free;
@@ -1264,6 +1318,9 @@ _unur_gibbs_debug_init_start( const struct unur_gen *gen )
   _unur_print_if_default(gen,GIBBS_SET_THINNING);
   fprintf(LOG,"\n%s: burn-in = %d",gen->genid,GEN->burnin);
   _unur_print_if_default(gen,GIBBS_SET_BURNIN);
+  fprintf(LOG,"\n%s: warm start for conditional distributions = %s",gen->genid,
+	  (gen->variant & GIBBS_VARFLAG_WARMSTART) ? "on" : "off");
+  _unur_print_if_default(gen,GIBBS_SET_WARMSTART);
   fprintf(LOG,"\n%s:\n",gen->genid);
   _unur_matrix_print_vector( GEN->dim, GEN->x0, "starting point = ", LOG, gen->genid, "\t   ");
 
@@ -1448,6 +1505,8 @@ _unur_gibbs_info( struct unur_gen *gen, int help )
  			(gen->set & GIBBS_SET_THINNING) ? "" : "[default]");
     _unur_string_append(info,"   burnin = %d  %s\n", GEN->burnin,
  			(gen->set & GIBBS_SET_THINNING) ? "" : "[default]");
+    if (gen->variant & GIBBS_VARFLAG_WARMSTART)
+      _unur_string_append(info,"   warmstart = on\n");
     
     _unur_string_append(info,"\n");
 
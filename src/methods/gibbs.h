@@ -251,6 +251,25 @@ int unur_gibbs_set_burnin( UNUR_PAR *parameters, int burnin );
    Default: @code{0}.
 */
 
+int unur_gibbs_set_warmstart( UNUR_PAR *parameters, int warmstart );
+/*
+   For each step of the Gibbs chain the generator for the conditional
+   distribution is reinitialized, i.e., a new hat function is built.
+   When @var{warmstart} is set to TRUE, then the construction points
+   of the hat function for the conditional distribution of the
+   previous step are reused (see unur_ars_set_reinit_warmstart()).
+   Then only logPDF and its derivative of the new conditional
+   distribution are evaluated at these points and the intervals of
+   the old hat are updated in place. If this fails then the new hat
+   is built as without warm start.
+
+   Warm start is only available for @code{c = 0} (the default).
+   Notice that the resulting chain differs from that without warm
+   start.
+
+   Default: FALSE.
+*/
+
 /*...........................................................................*/
 
 const double *unur_gibbs_get_state( UNUR_GEN *generator );
@@ -108,6 +108,13 @@
 /* intervals but less evaluations of the CDF (until there are too many       */
 /* intervals).                                                               */
 
+#define HINV_STACK_SIZE    (64)
+/* Initial size of the stack of nodes that are used during setup.            */
+
+#define HINV_TABLE_SIZE    (1024)
+/* Initial number of nodes for which memory is allocated in the table of     */
+/* splines. The table grows by 50% whenever it is full.                      */
+
 /*---------------------------------------------------------------------------*/
 /* Variants: none                                                            */
 
@@ -132,6 +139,7 @@
 #define HINV_SET_BOUNDARY       0x008u  /* boundary of computational region  */
 #define HINV_SET_GUIDEFACTOR    0x010u  /* relative size of guide table      */
 #define HINV_SET_MAX_IVS        0x020u  /* maximal number of intervals       */
+#define HINV_SET_USEFLOAT       0x040u  /* store coefficients as float       */
 
 /*---------------------------------------------------------------------------*/
 
@@ -169,6 +177,11 @@ static void _unur_hinv_free( struct unur_gen *gen );
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_hinv_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_hinv_sample( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
@@ -189,36 +202,47 @@ static int _unur_hinv_create_table( struct unur_gen *gen );
 /* create the table with splines                                             */
 /*---------------------------------------------------------------------------*/
 
-static struct unur_hinv_interval *_unur_hinv_interval_new( struct unur_gen *gen, double p, double u );
+static int _unur_hinv_interval_new( struct unur_gen *gen, struct unur_hinv_interval *iv,
+				    double p, double u );
 /*---------------------------------------------------------------------------*/
 /* make a new interval with node (u=F(p),p).                                 */
 /*---------------------------------------------------------------------------*/
 
-static struct unur_hinv_interval *_unur_hinv_interval_adapt( struct unur_gen *gen, 
-							     struct unur_hinv_interval *iv, 
-							     int *error_count_shortinterval );
+static void _unur_hinv_interval_insert( struct unur_gen *gen, const struct unur_hinv_interval *iv );
+/*---------------------------------------------------------------------------*/
+/* insert node into stack right of current left boundary.                    */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_hinv_interval_adapt( struct unur_gen *gen, int *error_count_shortinterval );
 /*---------------------------------------------------------------------------*/
 /* check parameters in interval and split or truncate where necessary.       */
 /*---------------------------------------------------------------------------*/
 
-static int _unur_hinv_interval_is_monotone( struct unur_gen *gen, struct unur_hinv_interval *iv );
+static int _unur_hinv_interval_is_monotone( struct unur_gen *gen, struct unur_hinv_interval *iv,
+					    struct unur_hinv_interval *next );
 /*---------------------------------------------------------------------------*/
 /* check whether the given interval is monotone.                             */
 /*---------------------------------------------------------------------------*/
 
-static int _unur_hinv_interval_parameter( struct unur_gen *gen, struct unur_hinv_interval *iv );
+static int _unur_hinv_interval_parameter( struct unur_gen *gen, struct unur_hinv_interval *iv,
+					  struct unur_hinv_interval *next );
 /*---------------------------------------------------------------------------*/
 /* compute all parameter for interval (spline coefficients).                 */
 /*---------------------------------------------------------------------------*/
 
+static void _unur_hinv_interval_store( struct unur_gen *gen, const struct unur_hinv_interval *iv );
+/*---------------------------------------------------------------------------*/
+/* append node and spline coefficients to table.                             */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_hinv_eval_polynomial( double x, double *coeff, int order );
 /*---------------------------------------------------------------------------*/
 /* evaluate polynomial.                                                      */
 /*---------------------------------------------------------------------------*/
 
-static int _unur_hinv_list_to_array( struct unur_gen *gen );
+static int _unur_hinv_finish_table( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
-/* copy list of intervals into double array.                                 */
+/* store remaining nodes into table and release unused memory.               */
 /*---------------------------------------------------------------------------*/
 
 static int _unur_hinv_make_guide_table( struct unur_gen *gen );
@@ -337,6 +361,7 @@ unur_hinv_new( const struct unur_distr *distr )
   PAR->max_ivs = 1000000;         /* maximal number of intervals             */
   PAR->stp = NULL;                /* starting nodes                          */
   PAR->n_stp = 0;                 /* number of starting nodes                */
+  PAR->use_float = FALSE;         /* store coefficients as double            */
 
   par->method   = UNUR_METH_HINV; /* method                                  */
   par->variant  = 0u;             /* default variant                         */
@@ -613,6 +638,38 @@ unur_hinv_set_max_intervals( struct unur_par *par, int max_ivs )
 
 /*---------------------------------------------------------------------------*/
 
+int
+unur_hinv_set_usefloat( struct unur_par *par, int usefloat )
+     /*----------------------------------------------------------------------*/
+     /* store coefficients of splines as float                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par       ... pointer to parameter for building generator object   */
+     /*   usefloat  ... whether float is used                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+
+  /* check input */
+  _unur_check_par_object( par, HINV );
+
+  /* store date */
+  PAR->use_float = (usefloat) ? TRUE : FALSE;
+
+  /* changelog */
+  par->set |= HINV_SET_USEFLOAT;
+
+  return UNUR_SUCCESS;
+
+} /* end of unur_hinv_set_usefloat() */
+
+/*---------------------------------------------------------------------------*/
+
 int
 unur_hinv_get_n_intervals( const struct unur_gen *gen )
      /*----------------------------------------------------------------------*/
@@ -659,6 +716,7 @@ unur_hinv_chg_truncated( struct unur_gen *gen, double left, double right )
   /* check arguments */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object(gen, HINV, UNUR_ERR_GEN_INVALID);
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* the truncated domain must be a subset of (computational) domain */
   if (left < GEN->bleft) {
@@ -683,7 +741,7 @@ unur_hinv_chg_truncated( struct unur_gen *gen, double left, double right )
      is available for the inverse CDF.
      So this is a safe guard against segfault for U=0. or U=1. */ 
   Uminbound = _unur_max(0.,GEN->intervals[0]);
-  Umaxbound = _unur_min(1.,GEN->intervals[(GEN->N-1)*(GEN->order+2)]);
+  Umaxbound = _unur_min(1.,GEN->intervals[(GEN->N-1)*GEN->row_size]);
 
   /* set bounds of U -- in respect to given bounds */
   Umin = (left > -UNUR_INFINITY) ? CDF(left)  : 0.;
@@ -772,19 +830,19 @@ _unur_hinv_init( struct unur_par *par )
     /* make entry in LOG file */
 #ifdef UNUR_ENABLE_LOGGING
     if (gen->debug) {
-      _unur_hinv_list_to_array( gen );
+      _unur_hinv_finish_table( gen );
       _unur_hinv_debug_init(gen,FALSE);
     }
 #endif
     _unur_hinv_free(gen); return NULL;
   }
 
-  /* copy linked list into array */
-  _unur_hinv_list_to_array( gen );
+  /* store remaining nodes into table */
+  _unur_hinv_finish_table( gen );
 
   /* adjust minimal and maximal U value */
   GEN->Umin = _unur_max(0.,GEN->intervals[0]);
-  GEN->Umax = _unur_min(1.,GEN->intervals[(GEN->N-1)*(GEN->order+2)]);
+  GEN->Umax = _unur_min(1.,GEN->intervals[(GEN->N-1)*GEN->row_size]);
 
   /* this setting of Umin and Umax guarantees that in the
      sampling algorithm U is always in a range where a table
@@ -839,12 +897,12 @@ _unur_hinv_reinit( struct unur_gen *gen )
   if ( (rcode = _unur_hinv_create_table(gen)) != UNUR_SUCCESS)
     return rcode;
 
-  /* copy linked list into array */
-  _unur_hinv_list_to_array( gen );
+  /* store remaining nodes into table */
+  _unur_hinv_finish_table( gen );
 
   /* adjust minimal and maximal U value */
   GEN->Umin = _unur_max(0.,GEN->intervals[0]);
-  GEN->Umax = _unur_min(1.,GEN->intervals[(GEN->N-1)*(GEN->order+2)]);
+  GEN->Umax = _unur_min(1.,GEN->intervals[(GEN->N-1)*GEN->row_size]);
 
   /* (re)set sampling routine */
   SAMPLE = _unur_hinv_getSAMPLE(gen);
@@ -895,6 +953,7 @@ _unur_hinv_create( struct unur_par *par )
   SAMPLE = _unur_hinv_getSAMPLE(gen);
   gen->destroy = _unur_hinv_free;
   gen->clone = _unur_hinv_clone;
+  gen->memsize = _unur_hinv_memsize;
   gen->reinit = _unur_hinv_reinit;
 
   /* copy parameters into generator object */
@@ -906,6 +965,7 @@ _unur_hinv_create( struct unur_par *par )
   GEN->max_ivs = PAR->max_ivs;           /* maximum number of intervals      */
   GEN->stp = PAR->stp;               /* pointer to array of starting points  */
   GEN->n_stp = PAR->n_stp;           /* number of construction points        */
+  GEN->use_float = PAR->use_float;   /* whether coefficients are float       */
 
   /* default values */
   GEN->tailcutoff_left  = -1.;       /* no cut-off by default                */
@@ -918,7 +978,13 @@ _unur_hinv_create( struct unur_par *par )
   GEN->Umax = 1.;
   GEN->N = 0;
   GEN->iv = NULL;
+  GEN->n_iv = 0;
+  GEN->iv_size = 0;
   GEN->intervals = NULL;
+  GEN->fcoeff = NULL;
+  GEN->row_size = (GEN->use_float) ? 2 : GEN->order+2;
+  GEN->intervals_size = 0;
+  GEN->N_stored = 0;
   GEN->guide_size = 0; 
   GEN->guide = NULL;
 
@@ -1011,8 +1077,15 @@ _unur_hinv_clone( const struct unur_gen *gen )
   clone = _unur_generic_clone( gen, GENTYPE );
 
   /* copy tables for generator object */
-  CLONE->intervals = _unur_xmalloc( GEN->N*(GEN->order+2) * sizeof(double) );
-  memcpy( CLONE->intervals, GEN->intervals, GEN->N*(GEN->order+2) * sizeof(double) );
+  CLONE->intervals = _unur_xmalloc( GEN->N*GEN->row_size * sizeof(double) );
+  memcpy( CLONE->intervals, GEN->intervals, GEN->N*GEN->row_size * sizeof(double) );
+  CLONE->intervals_size = GEN->N*GEN->row_size;
+  if (GEN->fcoeff) {
+    CLONE->fcoeff = _unur_xmalloc( GEN->N*GEN->order * sizeof(float) );
+    memcpy( CLONE->fcoeff, GEN->fcoeff, GEN->N*GEN->order * sizeof(float) );
+  }
+  CLONE->iv = NULL;    /* stack is only used during setup */
+  CLONE->n_iv = CLONE->iv_size = 0;
   CLONE->guide = _unur_xmalloc( GEN->guide_size * sizeof(int) );
   memcpy( CLONE->guide, GEN->guide, GEN->guide_size * sizeof(int) );
 
@@ -1045,17 +1118,12 @@ _unur_hinv_free( struct unur_gen *gen )
   /* we cannot use this generator object any more */
   SAMPLE = NULL;   /* make sure to show up a programming error */
 
-  /* free linked list of intervals */
-  if (GEN->iv) {
-    struct unur_hinv_interval *iv,*next;
-    for (iv = GEN->iv; iv != NULL; iv = next) {
-      next = iv->next;
-      free(iv);
-    }
-  }
+  /* free stack of nodes */
+  if (GEN->iv)        free (GEN->iv);
 
   /* free tables */
   if (GEN->intervals) free (GEN->intervals);
+  if (GEN->fcoeff)    free (GEN->fcoeff);
   if (GEN->guide)     free (GEN->guide);
 
   /* free memory */
@@ -1063,6 +1131,32 @@ _unur_hinv_free( struct unur_gen *gen )
 
 } /* end of _unur_hinv_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_hinv_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+
+  /* table of coefficients of splines */
+  if (GEN->intervals) size += GEN->intervals_size * sizeof(double);
+  if (GEN->fcoeff) size += (GEN->intervals_size / GEN->row_size) * GEN->order * sizeof(float);
+
+  /* stack of nodes (only used during setup) */
+  if (GEN->iv) size += GEN->iv_size * sizeof(struct unur_hinv_interval);
+
+  /* guide table */
+  if (GEN->guide) size += GEN->guide_size * sizeof(int);
+
+  return size;
+} /* end of _unur_hinv_memsize() */
+
 /*****************************************************************************/
 
 double
@@ -1117,21 +1211,31 @@ _unur_hinv_eval_approxinvcdf( const struct unur_gen *gen, double u )
      /*   return UNUR_INFINITY                                               */
      /*----------------------------------------------------------------------*/
 { 
-  int i;
+  int i, k;
+  const float *c;
+  double poly;
 
   /* check arguments */
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_INFINITY);
 
   /* look up in guide table and search for interval */
   i =  GEN->guide[(int) (GEN->guide_size*u)];
-  while (u > GEN->intervals[i+GEN->order+2])
-    i += GEN->order+2;
+  while (u > GEN->intervals[i+GEN->row_size])
+    i += GEN->row_size;
 
   /* rescale uniform random number */
-  u = (u-GEN->intervals[i])/(GEN->intervals[i+GEN->order+2] - GEN->intervals[i]);
+  u = (u-GEN->intervals[i])/(GEN->intervals[i+GEN->row_size] - GEN->intervals[i]);
 
   /* evaluate polynome */
-  return _unur_hinv_eval_polynomial( u, GEN->intervals+i+1, GEN->order );
+  if (! GEN->use_float)
+    return _unur_hinv_eval_polynomial( u, GEN->intervals+i+1, GEN->order );
+
+  /* coefficients stored as float: p + u*(c_1 + u*(c_2 + ...)) */
+  c = GEN->fcoeff + (i/2) * GEN->order;
+  poly = c[GEN->order-1];
+  for (k=GEN->order-2; k>=0; k--)
+    poly = u*poly + c[k];
+  return GEN->intervals[i+1] + u*poly;
 
 } /* end of _unur_hinv_eval_approxinvcdf() */
 
@@ -1236,14 +1340,16 @@ _unur_hinv_find_boundary( struct unur_gen *gen )
      /*   error code   ... on error                                          */
      /*----------------------------------------------------------------------*/
 {
+  struct unur_hinv_interval iv;
   double x,u;
   int i;
 
   /* check arguments */
   CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
 
-  /* reset counter for intervals */
+  /* reset counter for intervals and stack of nodes */
   GEN->N = 0;
+  GEN->n_iv = 0;
 
   /* boundary of the computational domain must not exceed domain of distribution */
   if (GEN->bleft  < DISTR.domain[0]) GEN->bleft  = DISTR.domain[0];
@@ -1281,8 +1387,9 @@ _unur_hinv_find_boundary( struct unur_gen *gen )
     _unur_warning(gen->genid,UNUR_ERR_DISTR_PROP,"cannot find l.h.s. of domain");
 
   /* make l.h.s. starting interval */
-  GEN->iv = _unur_hinv_interval_new(gen,GEN->bleft,u);
-  if (GEN->iv == NULL) return UNUR_ERR_GEN_DATA;
+  if (_unur_hinv_interval_new(gen,&iv,GEN->bleft,u) != UNUR_SUCCESS)
+    return UNUR_ERR_GEN_DATA;
+  _unur_hinv_interval_insert(gen,&iv);
 
 
   /* find right boundary point */
@@ -1317,8 +1424,10 @@ _unur_hinv_find_boundary( struct unur_gen *gen )
     _unur_warning(gen->genid,UNUR_ERR_DISTR_PROP,"cannot find r.h.s. of domain");
 
   /* make r.h.s. starting intervals */
-  GEN->iv->next = _unur_hinv_interval_new(gen,GEN->bright,u);
-  if (GEN->iv->next == NULL) return UNUR_ERR_GEN_DATA;
+  /* (it is inserted below the l.h.s. node) */
+  if (_unur_hinv_interval_new(gen,&iv,GEN->bright,u) != UNUR_SUCCESS)
+    return UNUR_ERR_GEN_DATA;
+  _unur_hinv_interval_insert(gen,&iv);
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -1338,64 +1447,75 @@ _unur_hinv_create_table( struct unur_gen *gen )
      /* return:                                                              */
      /*   UNUR_SUCCESS ... on success                                        */
      /*   error code   ... on error                                          */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   Intervals are processed from left to right. Nodes that are not     */
+     /*   finished yet are kept in a stack where the top element is the      */
+     /*   left boundary of the current interval. When an interval is        */
+     /*   accepted, its left boundary is appended to the table (see          */
+     /*   _unur_hinv_interval_store()). Thus the memory required during      */
+     /*   setup is not much larger than the table itself.                    */
      /*----------------------------------------------------------------------*/
 {
-  struct unur_hinv_interval *iv, *iv_new;
-  int i, error_count_shortinterval=0;
+  struct unur_hinv_interval iv, tmp;
+  int i, j, error_count_shortinterval=0;
   double Fx;
 
   /* check arguments */
   CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
 
+  /* table is empty */
+  GEN->N_stored = 0;
+
   /* find boundary point of computational interval */
+  /* stack: [ right boundary, left boundary ] */
   if (_unur_hinv_find_boundary(gen) != UNUR_SUCCESS)
     return UNUR_ERR_GEN_DATA;
 
   /* use starting design points of given */
   if (GEN->stp) {
-    iv = GEN->iv;
     for (i=0; i<GEN->n_stp; i++) {
       if (!_unur_FP_greater(GEN->stp[i],GEN->bleft)) continue; /* skip */
       if (!_unur_FP_less(GEN->stp[i],GEN->bright))   break;    /* no more points */
  
       Fx = CDF(GEN->stp[i]);
-      iv_new = _unur_hinv_interval_new(gen,GEN->stp[i],Fx);
-      if (iv_new == NULL) return UNUR_ERR_GEN_DATA;
-      iv_new->next = iv->next;
-      iv->next = iv_new;
-      iv = iv_new;
+      if (_unur_hinv_interval_new(gen,&iv,GEN->stp[i],Fx) != UNUR_SUCCESS)
+	return UNUR_ERR_GEN_DATA;
+      _unur_hinv_interval_insert(gen,&iv);
 
       if (Fx > GEN->tailcutoff_right)
 	/* there is no need to add another starting point in the r.h. tail */
 	break;
     }
+    /* nodes between the boundaries must be in decreasing order */
+    for (i=1, j=GEN->n_iv-2; i<j; i++, j--) {
+      tmp = GEN->iv[i];  GEN->iv[i] = GEN->iv[j];  GEN->iv[j] = tmp;
+    }
   }
 
   else /* mode - if known - is inserted as "default design point" */
     if( (gen->distr->set & UNUR_DISTR_SET_MODE) &&
         _unur_FP_greater(DISTR.mode, GEN->bleft) &&
         _unur_FP_less(DISTR.mode, GEN->bright) ) {
-      iv = GEN->iv;
-      iv_new = _unur_hinv_interval_new(gen,DISTR.mode,CDF(DISTR.mode));
-      if (iv_new == NULL) return UNUR_ERR_GEN_DATA;
-      iv_new->next = iv->next;
-      iv->next = iv_new;
+      if (_unur_hinv_interval_new(gen,&iv,DISTR.mode,CDF(DISTR.mode)) != UNUR_SUCCESS)
+	return UNUR_ERR_GEN_DATA;
+      _unur_hinv_interval_insert(gen,&iv);
     }
 
   /* now split intervals where approximation error is too large */
-  for (iv=GEN->iv; iv->next!=NULL; ) {
-    COOKIE_CHECK(iv,CK_HINV_IV,UNUR_ERR_COOKIE);
+  while (GEN->n_iv > 1) {
+    COOKIE_CHECK(GEN->iv+(GEN->n_iv-1),CK_HINV_IV,UNUR_ERR_COOKIE);
     if (GEN->N >= GEN->max_ivs) {
       /* emergency break */
       _unur_error(GENTYPE,UNUR_ERR_GEN_CONDITION,"too many intervals");
       return UNUR_ERR_GEN_CONDITION;
     }
-    iv = _unur_hinv_interval_adapt(gen,iv, &error_count_shortinterval);
-    if (iv == NULL) return UNUR_ERR_GEN_DATA;
+    if (_unur_hinv_interval_adapt(gen, &error_count_shortinterval) != UNUR_SUCCESS)
+      return UNUR_ERR_GEN_DATA;
   }
 
   /* last interval is only used to store right boundary */
-  iv->spline[0] = iv->p;
+  GEN->iv[0].spline[0] = GEN->iv[0].p;
 
   /* o.k. */
   return UNUR_SUCCESS;
@@ -1403,33 +1523,33 @@ _unur_hinv_create_table( struct unur_gen *gen )
 
 /*---------------------------------------------------------------------------*/
 
-struct unur_hinv_interval *
-_unur_hinv_interval_new( struct unur_gen *gen, double p, double u )
+int
+_unur_hinv_interval_new( struct unur_gen *gen, struct unur_hinv_interval *iv,
+			 double p, double u )
      /*----------------------------------------------------------------------*/
      /* make a new interval with node (u=F(p),p).                            */
      /*                                                                      */
      /* parameters:                                                          */
      /*   gen ... pointer to generator object                                */
+     /*   iv  ... pointer to interval for storing data                       */
      /*   p   ... left design point of new interval                          */
      /*   u   ... value of CDF at p, u=CDF(p)                                */
      /*                                                                      */
      /* return:                                                              */
-     /*   pointer to new interval                                            */
-     /*                                                                      */
-     /* error:                                                               */
-     /*   return NULL                                                        */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
      /*----------------------------------------------------------------------*/
 {
-  struct unur_hinv_interval *iv;
+  int i;
 
   /* check arguments */
-  CHECK_NULL(gen,NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,NULL);
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
 
   /* first check u */
   if (u<0.) {
     if (u < -UNUR_SQRT_DBL_EPSILON) {
       _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"CDF(x) < 0.");
-      return NULL;
+      return UNUR_ERR_GEN_DATA;
     }
     else { /* round off error */
       u = 0.;
@@ -1437,11 +1557,9 @@ _unur_hinv_interval_new( struct unur_gen *gen, double p, double u )
   }
   if (u>1.) {
     _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"CDF(x) > 1.");
-    return NULL;
+    return UNUR_ERR_GEN_DATA;
   }
 
-  /* we need new interval */
-  iv = _unur_xmalloc( sizeof(struct unur_hinv_interval) );
   COOKIE_SET(iv,CK_HINV_IV);
 
   /* compute and store data */
@@ -1458,107 +1576,153 @@ _unur_hinv_interval_new( struct unur_gen *gen, double p, double u )
     break;
   default:
     _unur_error(gen->genid,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
-    free(iv);
-    return NULL;
+    return UNUR_ERR_SHOULD_NOT_HAPPEN;
   }
 
-  iv->next = NULL;  /* add eol marker */
+  /* spline coefficients are computed later */
+  iv->spline[0] = p;
+  for (i=1; i<=UNUR_HINV_MAX_ORDER; i++)
+    iv->spline[i] = 0.;
+
   ++(GEN->N);   /* increment counter for intervals */
 
   /* o.k. */
-  return iv;
+  return UNUR_SUCCESS;
 
 } /* end of _unur_hinv_interval_new() */
 
 /*---------------------------------------------------------------------------*/
 
-struct unur_hinv_interval *
-_unur_hinv_interval_adapt( struct unur_gen *gen, struct unur_hinv_interval *iv,
-                           int *error_count_shortinterval )
+void
+_unur_hinv_interval_insert( struct unur_gen *gen, const struct unur_hinv_interval *iv )
      /*----------------------------------------------------------------------*/
-     /* check parameters in interval and split or truncate where necessary.  */
+     /* insert node into stack directly below the top element, i.e., as      */
+     /* right boundary of the current interval.                              */
+     /* if the stack is empty the node becomes the top element.              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   iv  ... pointer to node                                            */
+     /*----------------------------------------------------------------------*/
+{
+  /* enlarge stack if necessary */
+  if (GEN->n_iv >= GEN->iv_size) {
+    GEN->iv_size = (GEN->iv_size > 0) ? 2*GEN->iv_size : HINV_STACK_SIZE;
+    GEN->iv = _unur_xrealloc( GEN->iv, GEN->iv_size * sizeof(struct unur_hinv_interval) );
+  }
+
+  if (GEN->n_iv > 0) {
+    GEN->iv[GEN->n_iv] = GEN->iv[GEN->n_iv-1];
+    GEN->iv[GEN->n_iv-1] = *iv;
+  }
+  else
+    GEN->iv[0] = *iv;
+
+  ++(GEN->n_iv);
+
+} /* end of _unur_hinv_interval_insert() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_hinv_interval_adapt( struct unur_gen *gen, int *error_count_shortinterval )
+     /*----------------------------------------------------------------------*/
+     /* check parameters in current interval (given by the two top elements  */
+     /* of the stack of nodes) and split or truncate where necessary.        */
      /*                                                                      */
      /* parameters:                                                          */
      /*   gen ... pointer to generator object                                */
-     /*   iv  ... pointer to interval                                        */
      /*   error_count_shortinterval ... pointer to errorcount to supress too */
      /*                                 many error messages                  */
      /*                                                                      */
      /* return:                                                              */
-     /*   iv       ... if splitted                                           */
-     /*   iv->next ... if interval was o.k.                                  */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   if the interval is o.k., its left boundary is moved into the table */
+     /*   otherwise a new node is inserted into the stack.                   */
      /*----------------------------------------------------------------------*/
 {
   double p_new;   /* new design point */
-  struct unur_hinv_interval *iv_new, *iv_tmp;
+  struct unur_hinv_interval *iv, *next, iv_new;
   double x, Fx;
+  int n_chop;
 
   /* check arguments */
-  CHECK_NULL(gen,NULL);       COOKIE_CHECK(gen,CK_HINV_GEN,NULL);
-  CHECK_NULL(iv,NULL);        COOKIE_CHECK(iv,CK_HINV_IV,NULL);
-  CHECK_NULL(iv->next,NULL);  COOKIE_CHECK(iv->next,CK_HINV_IV,NULL);
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
+  if (GEN->n_iv < 2) {
+    _unur_error(gen->genid,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
+    return UNUR_ERR_SHOULD_NOT_HAPPEN;
+  }
+
+  /* current interval */
+  iv = GEN->iv + (GEN->n_iv-1);
+  next = iv - 1;
+  COOKIE_CHECK(iv,CK_HINV_IV,UNUR_ERR_COOKIE);
+  COOKIE_CHECK(next,CK_HINV_IV,UNUR_ERR_COOKIE);
 
   /* 1st check: right most interval (of at least 2)
      with CDF greater than GEN->tailcutoff_right */
 
-  iv_tmp = iv->next->next;
-  if(iv_tmp && iv->next->u > GEN->tailcutoff_right) {
+  if (GEN->n_iv > 2 && next->u > GEN->tailcutoff_right) {
     /* chop off right hand tail */
-    free (iv_tmp);
-    iv->next->next = NULL;
-    GEN->N--;
+    n_chop = GEN->n_iv - 2;
+    GEN->iv[0] = *next;
+    GEN->iv[1] = *iv;
+    GEN->n_iv = 2;
+    GEN->N -= n_chop;
     /* update right boundary */
-    GEN->bright = iv->next->p;
-    return iv;
+    GEN->bright = GEN->iv[0].p;
+    return UNUR_SUCCESS;
   }
 
   /* 2nd check: is the left most interval (of at least 2) 
      with CDF less than GEN->tailcutoff_left */
 
-  if (iv==GEN->iv && iv->next->next && iv->next->u < GEN->tailcutoff_left) {
+  if (GEN->N_stored == 0 && GEN->n_iv > 2 && next->u < GEN->tailcutoff_left) {
     /* chop off left hand tail */
-    iv_tmp = GEN->iv;
-    GEN->iv = iv->next;
-    free (iv_tmp);
+    --(GEN->n_iv);
     GEN->N--;
     /* update left boundary */
-    GEN->bleft = GEN->iv->p;
-    return GEN->iv;
+    GEN->bleft = next->p;
+    return UNUR_SUCCESS;
   }
 
   /* center of x-interval as splitting point */
-  p_new = 0.5 * (iv->next->p + iv->p);
+  p_new = 0.5 * (next->p + iv->p);
 
   /* we do not split an interval if is too close */
   /*  changing the below FP_equal to FP_same can strongly increase the number of
       intervals needed and may slightly decrease the MAError. In both cases the
       required u-precision is not reached due to numerical problems with very steep CDF*/
-  if (_unur_FP_equal(p_new,iv->p) || _unur_FP_equal(p_new,iv->next->p)) {
+  if (_unur_FP_equal(p_new,iv->p) || _unur_FP_equal(p_new,next->p)) {
     if(!(*error_count_shortinterval)){ 
       _unur_warning(gen->genid,UNUR_ERR_ROUNDOFF,
 		    "one or more intervals very short; possibly due to numerical problems with a pole or very flat tail");
       (*error_count_shortinterval)++;
     } 
     /* skip to next interval */
-    _unur_hinv_interval_parameter(gen,iv);
-    return iv->next;
+    _unur_hinv_interval_parameter(gen,iv,next);
+    _unur_hinv_interval_store(gen,iv);
+    --(GEN->n_iv);
+    return UNUR_SUCCESS;
   }
 
   /* 3rd check: |u_i - u_{i-1}| must not exceed threshold value */
   /* 4th check: monotonicity                                    */
 
-  if ( (iv->next->u - iv->u > HINV_MAX_U_LENGTH) ||
-       (! _unur_hinv_interval_is_monotone(gen,iv)) ) {
-    /* insert new interval into linked list */
-    iv_new = _unur_hinv_interval_new(gen,p_new,CDF(p_new));
-    if (iv_new == NULL) return NULL;
-    iv_new->next = iv->next;
-    iv->next = iv_new;
-    return iv;
+  if ( (next->u - iv->u > HINV_MAX_U_LENGTH) ||
+       (! _unur_hinv_interval_is_monotone(gen,iv,next)) ) {
+    /* insert new node into stack */
+    if (_unur_hinv_interval_new(gen,&iv_new,p_new,CDF(p_new)) != UNUR_SUCCESS)
+      return UNUR_ERR_GEN_DATA;
+    _unur_hinv_interval_insert(gen,&iv_new);
+    return UNUR_SUCCESS;
   }
 
   /* compute coefficients for spline (only necessary if monotone) */
-  _unur_hinv_interval_parameter(gen,iv);
+  _unur_hinv_interval_parameter(gen,iv,next);
 
   /* 5th check: error in u-direction */
 
@@ -1570,38 +1734,44 @@ _unur_hinv_interval_adapt( struct unur_gen *gen, struct unur_hinv_interval *iv,
   if (_unur_isnan(x)) { 
     _unur_error(gen->genid,UNUR_ERR_ROUNDOFF,
  		"NaN occured; possibly due to numerical problems with a pole or very flat tail");
-    return NULL;
+    return UNUR_ERR_ROUNDOFF;
    }
 
   /* check error */
-  if (!(fabs(Fx - 0.5*(iv->next->u + iv->u)) < (GEN->u_resolution * HINV_UERROR_CORRECTION))) {
+  if (!(fabs(Fx - 0.5*(next->u + iv->u)) < (GEN->u_resolution * HINV_UERROR_CORRECTION))) {
     /* error in u-direction too large */
     /* if possible we use the point x instead of p_new */
-    if(fabs(p_new-x)< HINV_XDEVIATION * (iv->next->p - iv->p))
-      iv_new = _unur_hinv_interval_new(gen,x,Fx);
-    else
-      iv_new = _unur_hinv_interval_new(gen,p_new,CDF(p_new));
-    if (iv_new == NULL) return NULL;
-    iv_new->next = iv->next;
-    iv->next = iv_new;
-    return iv;
+    if(fabs(p_new-x)< HINV_XDEVIATION * (next->p - iv->p)) {
+      if (_unur_hinv_interval_new(gen,&iv_new,x,Fx) != UNUR_SUCCESS)
+	return UNUR_ERR_GEN_DATA;
+    }
+    else {
+      if (_unur_hinv_interval_new(gen,&iv_new,p_new,CDF(p_new)) != UNUR_SUCCESS)
+	return UNUR_ERR_GEN_DATA;
+    }
+    _unur_hinv_interval_insert(gen,&iv_new);
+    return UNUR_SUCCESS;
   }
 
   /* interval o.k. */
-  return iv->next;
+  _unur_hinv_interval_store(gen,iv);
+  --(GEN->n_iv);
+  return UNUR_SUCCESS;
 
 } /* end of _unur_hinv_interval_adapt() */
 
 /*---------------------------------------------------------------------------*/
 
 int 
-_unur_hinv_interval_is_monotone( struct unur_gen *gen, struct unur_hinv_interval *iv )
+_unur_hinv_interval_is_monotone( struct unur_gen *gen, struct unur_hinv_interval *iv,
+				 struct unur_hinv_interval *next )
      /*----------------------------------------------------------------------*/
      /* check whether the given interval is monotone.                        */
      /*                                                                      */
      /* parameters:                                                          */
-     /*   gen ... pointer to generator object                                */
-     /*   iv  ... pointer to interval                                        */
+     /*   gen  ... pointer to generator object                               */
+     /*   iv   ... pointer to interval                                       */
+     /*   next ... pointer to node at right boundary of interval             */
      /*                                                                      */
      /* return:                                                              */
      /*   TRUE  ... if monotone                                              */
@@ -1616,11 +1786,11 @@ _unur_hinv_interval_is_monotone( struct unur_gen *gen, struct unur_hinv_interval
        as approximation we use the same check for order 5 */
   case 3:
     /* we skip the test if computing the bound has too many round-off errors */
-    if (_unur_iszero(iv->u) || _unur_FP_approx(iv->u,iv->next->u))
+    if (_unur_iszero(iv->u) || _unur_FP_approx(iv->u,next->u))
       return TRUE;
     /* difference quotient */
-    bound = 3.*(iv->next->p - iv->p)/(iv->next->u - iv->u);
-    return (1./iv->next->f > bound || 1./iv->f > bound) ? FALSE : TRUE;
+    bound = 3.*(next->p - iv->p)/(next->u - iv->u);
+    return (1./next->f > bound || 1./iv->f > bound) ? FALSE : TRUE;
   case 1:
     /* linear interpolation is always monotone */
   default:  /* we assume that we have checked GEN->order very often till now */
@@ -1632,13 +1802,15 @@ _unur_hinv_interval_is_monotone( struct unur_gen *gen, struct unur_hinv_interval
 /*---------------------------------------------------------------------------*/
 
 int
-_unur_hinv_interval_parameter( struct unur_gen *gen, struct unur_hinv_interval *iv )
+_unur_hinv_interval_parameter( struct unur_gen *gen, struct unur_hinv_interval *iv,
+			       struct unur_hinv_interval *next )
      /*----------------------------------------------------------------------*/
      /* compute all parameter for interval (spline coefficients).            */
      /*                                                                      */
      /* parameters:                                                          */
-     /*   gen ... pointer to generator object                                */
-     /*   iv  ... pointer to interval                                        */
+     /*   gen  ... pointer to generator object                               */
+     /*   iv   ... pointer to interval                                       */
+     /*   next ... pointer to node at right boundary of interval             */
      /*                                                                      */
      /* return:                                                              */
      /*   UNUR_SUCCESS ... on success                                        */
@@ -1648,20 +1820,20 @@ _unur_hinv_interval_parameter( struct unur_gen *gen, struct unur_hinv_interval *
   double delta_u, delta_p;
   double f1, fs0, fs1, fss0, fss1;
 
-  delta_u = iv->next->u - iv->u;
-  delta_p = iv->next->p - iv->p;
+  delta_u = next->u - iv->u;
+  delta_p = next->p - iv->p;
 
   switch (GEN->order) {
 
   case 5:    /* quintic Hermite interpolation */
-    if (iv->f > 0. && iv->next->f > 0. &&
+    if (iv->f > 0. && next->f > 0. &&
 	iv->df < UNUR_INFINITY && iv->df > -UNUR_INFINITY && 
-	iv->next->df < UNUR_INFINITY && iv->next->df > -UNUR_INFINITY ) {
+	next->df < UNUR_INFINITY && next->df > -UNUR_INFINITY ) {
       f1   = delta_p;
       fs0  = delta_u / iv->f;      
-      fs1  = delta_u / iv->next->f;
+      fs1  = delta_u / next->f;
       fss0 = -delta_u * delta_u * iv->df / (iv->f * iv->f * iv->f);
-      fss1 = -delta_u * delta_u * iv->next->df / (iv->next->f * iv->next->f * iv->next->f);
+      fss1 = -delta_u * delta_u * next->df / (next->f * next->f * next->f);
       
       iv->spline[0] = iv->p;
       iv->spline[1] = fs0;
@@ -1679,11 +1851,11 @@ _unur_hinv_interval_parameter( struct unur_gen *gen, struct unur_hinv_interval *
     /* FALLTHROUGH */
 
   case 3:    /* cubic Hermite interpolation */
-    if (iv->f > 0. && iv->next->f > 0.) {
+    if (iv->f > 0. && next->f > 0.) {
       iv->spline[0] = iv->p;
       iv->spline[1] = delta_u / iv->f;
-      iv->spline[2] = 3.* delta_p - delta_u * (2./iv->f + 1./iv->next->f);
-      iv->spline[3] = -2.* delta_p + delta_u * (1./iv->f + 1./iv->next->f);
+      iv->spline[2] = 3.* delta_p - delta_u * (2./iv->f + 1./next->f);
+      iv->spline[3] = -2.* delta_p + delta_u * (1./iv->f + 1./next->f);
       return UNUR_SUCCESS;
     }
     else {
@@ -1733,11 +1905,55 @@ _unur_hinv_eval_polynomial( double x, double *coeff, int order )
 
 /*---------------------------------------------------------------------------*/
 
+void
+_unur_hinv_interval_store( struct unur_gen *gen, const struct unur_hinv_interval *iv )
+     /*----------------------------------------------------------------------*/
+     /* append node and coefficients of spline to table.                     */
+     /* the table is enlarged if necessary.                                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   iv  ... pointer to interval                                        */
+     /*----------------------------------------------------------------------*/
+{
+  double *row;
+  float *frow;
+  int n_alloc;
+  int j;
+
+  /* enlarge table if necessary */
+  if ((GEN->N_stored+1) * GEN->row_size > GEN->intervals_size) {
+    n_alloc = GEN->N_stored + _unur_max(GEN->N_stored/2, HINV_TABLE_SIZE);
+    GEN->intervals_size = n_alloc * GEN->row_size;
+    GEN->intervals = _unur_xrealloc( GEN->intervals, GEN->intervals_size * sizeof(double) );
+    if (GEN->use_float)
+      GEN->fcoeff = _unur_xrealloc( GEN->fcoeff, n_alloc * GEN->order * sizeof(float) );
+  }
+
+  /* store data */
+  row = GEN->intervals + GEN->N_stored * GEN->row_size;
+  row[0] = iv->u;
+  if (GEN->use_float) {
+    row[1] = iv->spline[0];
+    frow = GEN->fcoeff + GEN->N_stored * GEN->order;
+    for (j=0; j<GEN->order; j++)
+      frow[j] = (float) iv->spline[j+1];
+  }
+  else {
+    memcpy( row+1, iv->spline, (GEN->order+1)*sizeof(double) );
+  }
+
+  ++(GEN->N_stored);
+
+} /* end of _unur_hinv_interval_store() */
+
+/*---------------------------------------------------------------------------*/
+
 int
-_unur_hinv_list_to_array( struct unur_gen *gen )
+_unur_hinv_finish_table( struct unur_gen *gen )
      /*----------------------------------------------------------------------*/
-     /* copy list of intervals into double array.                            */
-     /* the linked list is freed.                                            */
+     /* store remaining nodes of stack into table and free stack.            */
+     /* unused memory of the table is released.                              */
      /*                                                                      */
      /* parameters:                                                          */
      /*   gen ... pointer to generator object                                */
@@ -1747,33 +1963,33 @@ _unur_hinv_list_to_array( struct unur_gen *gen )
      /*   error code   ... on error                                          */
      /*----------------------------------------------------------------------*/
 {
-  int i; 
-  struct unur_hinv_interval *iv, *next;
-
   /* check arguments */
   CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
 
-  /* allocate memory */
-  GEN->intervals = 
-    _unur_xrealloc( GEN->intervals, GEN->N*(GEN->order+2)*sizeof(double) );
-
-  i = 0;
-  for (iv=GEN->iv; iv!=NULL; iv=next) {
-    /* copy */
-    GEN->intervals[i] = iv->u;
-    memcpy( GEN->intervals+(i+1), &(iv->spline), (GEN->order+1)*sizeof(double) );
-    i += GEN->order+2;
-    /* and free linked list */
-    next = iv->next;
-    free(iv);
-  }
+  /* store remaining nodes.                                     */
+  /* (after a successful setup this is the right boundary only) */
+  for ( ; GEN->n_iv > 0; --(GEN->n_iv) )
+    _unur_hinv_interval_store(gen, GEN->iv + (GEN->n_iv-1));
 
-  /* linked list is now empty */
+  /* stack is not required any more */
+  if (GEN->iv) free(GEN->iv);
   GEN->iv = NULL;
+  GEN->iv_size = 0;
+
+  /* number of nodes */
+  GEN->N = GEN->N_stored;
+
+  /* release unused memory */
+  if (GEN->N > 0) {
+    GEN->intervals_size = GEN->N * GEN->row_size;
+    GEN->intervals = _unur_xrealloc( GEN->intervals, GEN->intervals_size * sizeof(double) );
+    if (GEN->use_float)
+      GEN->fcoeff = _unur_xrealloc( GEN->fcoeff, GEN->N * GEN->order * sizeof(float) );
+  }
 
   /* o.k. */
   return UNUR_SUCCESS;
-} /* end of _unur_hinv_list_to_array() */
+} /* end of _unur_hinv_finish_table() */
 
 /*---------------------------------------------------------------------------*/
 
@@ -1801,16 +2017,16 @@ _unur_hinv_make_guide_table( struct unur_gen *gen )
   if (GEN->guide_size <= 0) GEN->guide_size = 1; 
   GEN->guide = _unur_xrealloc( GEN->guide, GEN->guide_size * sizeof(int) );
 
-  imax = (GEN->N-2) * (GEN->order+2);
+  imax = (GEN->N-2) * GEN->row_size;
 
   /* u value at end of interval */
-# define u(i)  (GEN->intervals[(i)+GEN->order+2])
+# define u(i)  (GEN->intervals[(i)+GEN->row_size])
 
   i = 0;
   GEN->guide[0] = 0;
   for( j=1; j<GEN->guide_size ;j++ ) {
     while( u(i) < (j/(double)GEN->guide_size) && i <= imax)
-      i += GEN->order+2;
+      i += GEN->row_size;
     if (i > imax) break;
     GEN->guide[j]=i;
   }
@@ -1948,7 +2164,7 @@ _unur_hinv_debug_intervals( const struct unur_gen *gen )
      /*   gen ... pointer to generator object                                */
      /*----------------------------------------------------------------------*/
 {
-  int i,n;
+  int i,j,n;
   FILE *LOG;
 
   /* check arguments */
@@ -1957,22 +2173,25 @@ _unur_hinv_debug_intervals( const struct unur_gen *gen )
   LOG = unur_get_stream();
 
   fprintf(LOG,"%s: Intervals: %d\n",gen->genid,GEN->N-1);
+  fprintf(LOG,"%s: coefficients stored as %s",gen->genid,
+	  (GEN->use_float) ? "float" : "double");
+  _unur_print_if_default(gen,HINV_SET_USEFLOAT);
+  fprintf(LOG,"\n");
 
   if (gen->debug & HINV_DEBUG_TABLE) {
     fprintf(LOG,"%s:   Nr.      u=CDF(p)     p=spline[0]   spline[1]    ...\n",gen->genid);
     for (n=0; n<GEN->N-1; n++) {
-      i = n*(GEN->order+2);
-      fprintf(LOG,"%s:[%4d]: %#12.6g  %#12.6g  %#12.6g", gen->genid, n,
-	      GEN->intervals[i], GEN->intervals[i+1], GEN->intervals[i+2]);
-      if (GEN->order>1)
-	fprintf(LOG,"  %#12.6g  %#12.6g", GEN->intervals[i+3], GEN->intervals[i+4]);
-      if (GEN->order>3)
-	fprintf(LOG,"  %#12.6g  %#12.6g", GEN->intervals[i+5], GEN->intervals[i+6]);
+      i = n*GEN->row_size;
+      fprintf(LOG,"%s:[%4d]: %#12.6g  %#12.6g", gen->genid, n,
+	      GEN->intervals[i], GEN->intervals[i+1]);
+      for (j=0; j<GEN->order; j++)
+	fprintf(LOG,"  %#12.6g", (GEN->use_float) 
+		? GEN->fcoeff[n*GEN->order+j] : GEN->intervals[i+2+j]);
       fprintf(LOG,"\n");
     }
     /* the following might cause troubles when creating the tables fails. */
     /* so we remove it.                                                   */
-    /*     i = n*(GEN->order+2); */
+    /*     i = n*GEN->row_size; */
     /*     fprintf(LOG,"%s:[%4d]: %#12.6g  %#12.6g  (right boundary)\n", gen->genid, n, */
     /* 	    GEN->intervals[i], GEN->intervals[i+1] ); */
   }
@@ -2073,6 +2292,10 @@ _unur_hinv_info( struct unur_gen *gen, int help )
   }
 
   _unur_string_append(info,"   # intervals      = %d\n", GEN->N-1);
+  _unur_string_append(info,"   table size       = %g kB  [coefficients stored as %s]\n",
+		      GEN->N * (GEN->row_size*sizeof(double) + 
+				((GEN->use_float) ? GEN->order*sizeof(float) : 0)) / 1024.,
+		      (GEN->use_float) ? "float" : "double");
   _unur_string_append(info,"\n");
   
 
@@ -2087,6 +2310,9 @@ _unur_hinv_info( struct unur_gen *gen, int help )
     
     if (gen->set & HINV_SET_MAX_IVS)
       _unur_string_append(info,"   max_intervals = %d\n", GEN->max_ivs);
+
+    if (GEN->use_float)
+      _unur_string_append(info,"   usefloat = on\n");
     
     _unur_string_append(info,"   boundary = (%g,%g)  %s\n", GEN->bleft, GEN->bright,
 			(gen->set & HINV_SET_BOUNDARY) ? "" : "[computed]");
@@ -263,6 +263,21 @@ int unur_hinv_set_max_intervals( UNUR_PAR *parameters, int max_ivs );
    Default is @code{1000000} (1.e6).
 */
 
+int unur_hinv_set_usefloat( UNUR_PAR *parameters, int usefloat );
+/* 
+   If @var{usefloat} is TRUE, then the coefficients of the
+   interpolating polynomials are stored as @code{float} instead of
+   @code{double}. The nodes (i.e., the u-values and the corresponding
+   x-values) are still stored with double precision. This reduces the
+   size of the table by about 40% (for order 5) and thus increases
+   the chance that the table fits into the cache.
+   However, the rounding errors of the coefficients may increase the
+   u-error. Thus it should only be used for moderate u-resolutions
+   (about @code{1.e-7} to @code{1.e-8}).
+
+   Default is FALSE.
+*/
+
 int unur_hinv_get_n_intervals( const UNUR_GEN *generator );
 /* 
    Get number of nodes (design points) used for Hermite interpolation in 
@@ -44,6 +44,7 @@ struct unur_hinv_par {
   const double *stp;       /* pointer to array of starting points            */
   int     n_stp;           /* number of construction points at start         */
   int     max_ivs;         /* maximum number of intervals                    */
+  int     use_float;       /* whether coefficients are stored as float       */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -58,8 +59,6 @@ struct unur_hinv_interval {
   double f;                /* PDF at node p (u=CDF(p))                        */
   double df;               /* derivative of PDF at node p (u=CDF(p))          */
 
-  struct unur_hinv_interval *next;  /* pointer to next element in list        */
-
 #ifdef UNUR_COOKIES
   unsigned cookie;         /* magic cookie                                    */
 #endif
@@ -77,7 +76,16 @@ struct unur_hinv_gen {
 			      [0] ... u_{i-1} = CDF at left design point
 			      [1] ... p_{i-1} = left design point = spline[0]
 			      [2]-[order+1] ... spline[1] - spline[order] 
-			      size of the array = N * (2+order)              */
+			      size of the array = N * (2+order)              
+			      (if coefficients are stored as float then only
+			      [0] and [1] and the block size is 2)           */
+  float  *fcoeff;          /* pointer to array for storing spline[1] -
+			      spline[order] as float (in blocks of size 
+			      order); NULL if not used                      */
+  int     row_size;        /* size of blocks in array 'intervals'            */
+  int     use_float;       /* whether coefficients are stored as float       */
+  int     intervals_size;  /* number of doubles allocated for 'intervals'    */
+  int     N_stored;        /* number of nodes already stored in arrays       */
 
   int    *guide;           /* pointer to guide table                         */ 
   int     guide_size;      /* size of guide table                            */
@@ -90,7 +98,13 @@ struct unur_hinv_gen {
   double  bleft;           /* left border of the computational domain        */
   double  bright;          /* right border of the computational domain       */
 
-  struct unur_hinv_interval *iv; /* linked list of splines (only used in setup) */
+  struct unur_hinv_interval *iv; /* stack of nodes that are not stored in
+			      array yet (only used in setup):
+			      iv[n_iv-1] is the left boundary of the
+			      current interval, nodes to its right are stored
+			      in decreasing order                           */
+  int     n_iv;            /* number of nodes in stack                       */
+  int     iv_size;         /* size of stack                                  */
   double  tailcutoff_left; /* cut point for left hand tail (u-value)         */ 
   double  tailcutoff_right;/* cut point for right hand tail (u-value)        */ 
   int     max_ivs;         /* maximum number of intervals                    */
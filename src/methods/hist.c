@@ -90,6 +90,11 @@ static void _unur_hist_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_hist_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_hist_sample( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
@@ -285,6 +290,7 @@ _unur_hist_create( struct unur_par *par )
   SAMPLE = _unur_hist_getSAMPLE(gen);
   gen->destroy = _unur_hist_free;
   gen->clone = _unur_hist_clone;
+  gen->memsize = _unur_hist_memsize;
 
   /* make sure that the domain coincides with bin data      */
   if (DISTR.hist_bins) {
@@ -391,6 +397,26 @@ _unur_hist_free( struct unur_gen *gen )
 
 } /* end of _unur_hist_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_hist_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size = 0;
+
+  /* cumulated probabilities and guide table */
+  if (GEN->cumpv) size += GEN->n_hist * sizeof(double);
+  if (GEN->guide_table) size += GEN->n_hist * sizeof(int);
+
+  return size;
+} /* end of _unur_hist_memsize() */
+
 /*****************************************************************************/
 
 double
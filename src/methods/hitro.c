@@ -1174,6 +1174,8 @@ _unur_hitro_coord_sample_cvec( struct unur_gen *gen, double *vec )
   /* pointer to auxiliary working array */
   vuaux = GEN->vu;
 
+  _unur_stats_count(gen,sample);
+
   for (thinning = GEN->thinning; thinning > 0; --thinning) {
 
     /* update coordinate direction */
@@ -1217,6 +1219,8 @@ _unur_hitro_coord_sample_cvec( struct unur_gen *gen, double *vec )
 
     /* --- new coordinate for next point --- */
     while (1) {
+      _unur_stats_count(gen,trial);
+      _unur_stats_count(gen,pdf);
       U = _unur_call_urng(gen->urng);
       vuaux[coord] = U * lmin + (1.-U) * lmax;
       if (_unur_hitro_vu_is_inside_region(gen,vuaux) )
@@ -1274,6 +1278,8 @@ _unur_hitro_randomdir_sample_cvec( struct unur_gen *gen, double *vec )
   /* pointer to auxiliary working array */
   vuaux = GEN->vu;
 
+  _unur_stats_count(gen,sample);
+
   for (thinning = GEN->thinning; thinning > 0; --thinning) {
 
     /* new random direction */
@@ -1321,6 +1327,8 @@ _unur_hitro_randomdir_sample_cvec( struct unur_gen *gen, double *vec )
 
     /* --- new coordinate for next point --- */
     while (1) {
+      _unur_stats_count(gen,trial);
+      _unur_stats_count(gen,pdf);
       U = _unur_call_urng(gen->urng); 
       lambda = U * lb[0] + (1.-U) * lb[1];
       new_point(lambda);
@@ -136,6 +136,11 @@ static double _unur_hrb_sample_check( struct unur_gen *gen );
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_hrb_sample_nhpp( struct unur_gen *gen, double T, double *times, int size, int *n_events );
+/*---------------------------------------------------------------------------*/
+/* sample event times of non-homogeneous Poisson process.                    */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -328,6 +333,7 @@ unur_hrb_chg_verify( struct unur_gen *gen, int verify )
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, HRB, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* we must not change this switch when sampling has been disabled by
      using a pointer to the error producing routine                          */
@@ -421,7 +427,9 @@ _unur_hrb_reinit( struct unur_gen *gen )
   /* (re)set sampling routine */
   SAMPLE = _unur_hrb_getSAMPLE(gen);
 
-  /* nothing to do */
+  /* discard unused exponential spacings */
+  _unur_hr_spacings_reset(&(GEN->spacings));
+
   return UNUR_SUCCESS;
 } /* end of _unur_hrb_reinit() */
 
@@ -461,6 +469,7 @@ _unur_hrb_create( struct unur_par *par )
   gen->destroy = _unur_hrb_free;
   gen->clone = _unur_hrb_clone;
   gen->reinit = _unur_hrb_reinit;
+  gen->sample_nhpp = _unur_hrb_sample_nhpp;
 
   /* copy parameters into generator object */
   GEN->upper_bound = PAR->upper_bound;   /* upper bound for hazard rate        */ 
@@ -469,6 +478,7 @@ _unur_hrb_create( struct unur_par *par )
 
   /* initialize variables */
   GEN->left_border = 0.;             /* left border of domain                 */
+  _unur_hr_spacings_reset(&(GEN->spacings)); /* no exponential spacings    */
 
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
@@ -702,6 +712,86 @@ _unur_hrb_sample_check( struct unur_gen *gen )
 
 } /* end of _unur_hrb_sample_check() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_hrb_sample_nhpp( struct unur_gen *gen, double T, double *times, int size, int *n_events )
+     /*----------------------------------------------------------------------*/
+     /* sample all event times in [left_border,T] of non-homogeneous Poisson */
+     /* process with intensity function given by the hazard rate.            */
+     /*                                                                      */
+     /* The events are obtained by thinning of a homogeneous Poisson process */
+     /* with rate given by the upper bound for the hazard rate.              */
+     /* The candidate points are computed for a whole block of exponential   */
+     /* spacings and then the hazard rate is evaluated at all of them.       */
+     /* Spacings that are not used are kept for the next call.               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen      ... pointer to generator object                           */
+     /*   T        ... end of time interval                                  */
+     /*   times    ... pointer to array of (at least) length size            */
+     /*   size     ... length of array times                                 */
+     /*   n_events ... pointer for storing number of events                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   UNUR_ERR_GEN_SAMPLING ... if array times is too small              */
+     /*----------------------------------------------------------------------*/
+{
+  double X[UNUR_HR_SPACINGS_BLOCK];   /* candidate points                    */
+  double H[UNUR_HR_SPACINGS_BLOCK];   /* hazard rate at candidate points     */
+  double *E;                          /* exponential spacings                */
+  double lambda;
+  double t;
+  int n = 0;                          /* number of events                    */
+  int m, k, i;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HRB_GEN,UNUR_ERR_COOKIE);
+
+  /* parameter for majorizing hazard rate */
+  lambda = GEN->upper_bound;
+
+  /* starting point */
+  t = GEN->left_border;
+
+  do {
+    /* candidate points for block of spacings */
+    m = _unur_hr_spacings_fill(gen,&(GEN->spacings));
+    E = GEN->spacings.E + GEN->spacings.next;
+    for (k=0; k<m; k++) {
+      t += E[k] / lambda;
+      if (t > T) break;
+      X[k] = t;
+    }
+
+    /* used spacings (including the one that exceeds T) */
+    GEN->spacings.next += (k<m) ? k+1 : m;
+
+    /* hazard rate at all candidate points */
+    for (i=0; i<k; i++)
+      H[i] = HR(X[i]);
+
+    /* verify upper bound */
+    if (gen->variant & HRB_VARFLAG_VERIFY)
+      for (i=0; i<k; i++)
+	if ( (1.+UNUR_EPSILON) * lambda < H[i] )
+	  _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"upper bound not valid");
+
+    /* thinning */
+    for (i=0; i<k; i++) {
+      if ( lambda * _unur_call_urng(gen->urng) <= H[i] ) {
+	if (n >= size) { *n_events = n; return UNUR_ERR_GEN_SAMPLING; }
+	times[n++] = X[i];
+      }
+    }
+  } while (k == m);
+
+  *n_events = n;
+  return UNUR_SUCCESS;
+
+} /* end of _unur_hrb_sample_nhpp() */
+
 /*****************************************************************************/
 /**  Auxilliary Routines                                                    **/
 /*****************************************************************************/
@@ -82,6 +82,10 @@
       distribution and run unur_reinit() to reinitialize the generator object.
       Notice, that the upper bound given by the unur_hrb_set_upperbound() call
       cannot be changed and must be valid for the changed distribution.
+
+      All event times of the (non-homogeneous) Poisson process or the
+      renewal process with the given hazard rate in some time interval
+      can be generated by a single call to unur_sample_hr_process().
    =END
 */
 
@@ -45,6 +45,7 @@ struct unur_hrb_par {
 struct unur_hrb_gen { 
   double upper_bound;                 /* upper bound for hazard rate         */
   double left_border;                 /* left border of domain               */
+  struct unur_hr_spacings spacings;   /* exponential spacings for NHPP       */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -131,6 +131,11 @@ static double _unur_hrd_sample_check( struct unur_gen *gen );
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_hrd_sample_nhpp( struct unur_gen *gen, double T, double *times, int size, int *n_events );
+/*---------------------------------------------------------------------------*/
+/* sample event times of non-homogeneous Poisson process.                    */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -286,6 +291,7 @@ unur_hrd_chg_verify( struct unur_gen *gen, int verify )
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, HRD, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* we must not change this switch when sampling has been disabled by
      using a pointer to the error producing routine                          */
@@ -379,7 +385,9 @@ _unur_hrd_reinit( struct unur_gen *gen )
   /* (re)set sampling routine */
   SAMPLE = _unur_hrd_getSAMPLE(gen);
 
-  /* nothing to do */
+  /* discard unused exponential spacings */
+  _unur_hr_spacings_reset(&(GEN->spacings));
+
   return UNUR_SUCCESS;
 } /* end of _unur_hrd_reinit() */
 
@@ -419,11 +427,13 @@ _unur_hrd_create( struct unur_par *par )
   gen->destroy = _unur_hrd_free;
   gen->clone = _unur_hrd_clone;
   gen->reinit = _unur_hrd_reinit;
+  gen->sample_nhpp = _unur_hrd_sample_nhpp;
 
   /* default values */
 
   /* initialize variables */
   GEN->left_border = 0.;             /* left border of domain                 */
+  _unur_hr_spacings_reset(&(GEN->spacings)); /* no exponential spacings    */
 
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
@@ -665,6 +675,82 @@ _unur_hrd_sample_check( struct unur_gen *gen )
 
 } /* end of _unur_hrd_sample_check() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_hrd_sample_nhpp( struct unur_gen *gen, double T, double *times, int size, int *n_events )
+     /*----------------------------------------------------------------------*/
+     /* sample all event times in [left_border,T] of non-homogeneous Poisson */
+     /* process with intensity function given by the hazard rate.            */
+     /*                                                                      */
+     /* The events are obtained by thinning where the hazard rate at the     */
+     /* last candidate point is used as dominating intensity.                */
+     /* The exponential spacings are taken from a block; spacings that are   */
+     /* not used are kept for the next call.                                 */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen      ... pointer to generator object                           */
+     /*   T        ... end of time interval                                  */
+     /*   times    ... pointer to array of (at least) length size            */
+     /*   size     ... length of array times                                 */
+     /*   n_events ... pointer for storing number of events                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   UNUR_ERR_GEN_SAMPLING ... if array times is too small              */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  double lambda;
+  double t, hrt;
+  int n = 0;                          /* number of events                    */
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HRD_GEN,UNUR_ERR_COOKIE);
+
+  /* parameter for majorizing hazard rate */
+  lambda = GEN->upper_bound;
+
+  /* starting point */
+  t = GEN->left_border;
+
+  for(;;) {
+    /* next candidate point */
+    t += _unur_hr_spacings_next(gen,&(GEN->spacings)) / lambda;
+    if (t > T) break;
+
+    /* hazard rate at candidate point */
+    hrt = HR(t);
+
+    /* verify upper bound */
+    if ( (gen->variant & HRD_VARFLAG_VERIFY) && (1.+UNUR_EPSILON) * lambda < hrt )
+      _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"HR not decreasing");
+
+    /* thinning */
+    if ( lambda * _unur_call_urng(gen->urng) <= hrt ) {
+      if (n >= size) { *n_events = n; return UNUR_ERR_GEN_SAMPLING; }
+      times[n++] = t;
+    }
+
+    /* update majorizing hazard rate */
+    if (hrt > 0.)
+      lambda = hrt;
+    else if (_unur_iszero(hrt))
+      /* hazard rate vanishes: there are no more events */
+      break;
+    else {
+      /* the given function is not a hazard rate */
+      _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"HR not valid");
+      *n_events = n;
+      return UNUR_ERR_GEN_CONDITION;
+    }
+  }
+
+  *n_events = n;
+  return UNUR_SUCCESS;
+
+} /* end of _unur_hrd_sample_nhpp() */
+
 /*****************************************************************************/
 /**  Auxilliary Routines                                                    **/
 /*****************************************************************************/
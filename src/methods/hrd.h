@@ -76,6 +76,10 @@
       It is possible to change the parameters and the domain of the chosen 
       distribution and run unur_reinit() to reinitialize the generator object.
 
+      All event times of the (non-homogeneous) Poisson process or the
+      renewal process with the given hazard rate in some time interval
+      can be generated by a single call to unur_sample_hr_process().
+
    =END
 */
 
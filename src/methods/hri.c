@@ -136,6 +136,11 @@ static double _unur_hri_sample_check( struct unur_gen *gen );
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_hri_sample_nhpp( struct unur_gen *gen, double T, double *times, int size, int *n_events );
+/*---------------------------------------------------------------------------*/
+/* sample event times of non-homogeneous Poisson process.                    */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -332,6 +337,7 @@ unur_hri_chg_verify( struct unur_gen *gen, int verify )
   /* check input */
   _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
   _unur_check_gen_object( gen, HRI, UNUR_ERR_GEN_INVALID );
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
 
   /* we must not change this switch when sampling has been disabled by
      using a pointer to the error producing routine                          */
@@ -425,7 +431,9 @@ _unur_hri_reinit( struct unur_gen *gen )
   /* (re)set sampling routine */
   SAMPLE = _unur_hri_getSAMPLE(gen);
 
-  /* nothing to do */
+  /* discard unused exponential spacings */
+  _unur_hr_spacings_reset(&(GEN->spacings));
+
   return UNUR_SUCCESS;
 } /* end of _unur_hri_reinit() */
 
@@ -465,6 +473,7 @@ _unur_hri_create( struct unur_par *par )
   gen->destroy = _unur_hri_free;
   gen->clone = _unur_hri_clone;
   gen->reinit = _unur_hri_reinit;
+  gen->sample_nhpp = _unur_hri_sample_nhpp;
 
   /* copy parameters into generator object */
   GEN->p0 = PAR->p0;                  /* design (splitting) point              */
@@ -475,6 +484,7 @@ _unur_hri_create( struct unur_par *par )
 
   /* initialize variables */
   GEN->left_border = 0.;             /* left border of domain                 */
+  _unur_hr_spacings_reset(&(GEN->spacings)); /* no exponential spacings    */
 
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
@@ -875,6 +885,99 @@ _unur_hri_sample_check( struct unur_gen *gen )
 
 } /* end of _unur_hri_sample_check() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_hri_sample_nhpp( struct unur_gen *gen, double T, double *times, int size, int *n_events )
+     /*----------------------------------------------------------------------*/
+     /* sample all event times in [left_border,T] of non-homogeneous Poisson */
+     /* process with intensity function given by the hazard rate.            */
+     /*                                                                      */
+     /* The events are obtained by thinning with a piecewise constant        */
+     /* dominating intensity lambda. Each piece [a,b] has length about       */
+     /* min(p0-left_border, 1/HR(a)) and lambda = HR(b).                     */
+     /* The exponential spacings are taken from a block. If a spacing        */
+     /* exceeds the current piece, then its remaining part (which is again   */
+     /* exponentially distributed) is used in the next piece.                */
+     /* Spacings that are not used are kept for the next call.               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen      ... pointer to generator object                           */
+     /*   T        ... end of time interval                                  */
+     /*   times    ... pointer to array of (at least) length size            */
+     /*   size     ... length of array times                                 */
+     /*   n_events ... pointer for storing number of events                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   UNUR_ERR_GEN_SAMPLING ... if array times is too small              */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  double E;                           /* (remaining) exponential spacing     */
+  double lambda;                      /* dominating intensity in piece       */
+  double t, b;                        /* current point, right end of piece   */
+  double len;                         /* (maximal) length of pieces          */
+  int n = 0;                          /* number of events                    */
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HRI_GEN,UNUR_ERR_COOKIE);
+
+  /* starting point */
+  t = b = GEN->left_border;
+  len = GEN->p0 - GEN->left_border;
+  lambda = HR(t);
+
+  /* first exponential spacing */
+  E = _unur_hr_spacings_next(gen,&(GEN->spacings));
+
+  while (t < T) {
+
+    if (t >= b) {
+      /* next piece with constant dominating intensity.
+	 lambda is the hazard rate at the left boundary of the piece. */
+      b = t + len / (1. + lambda * len);
+      if (b > T) b = T;
+      lambda = HR(b);
+      if (! (b > t && lambda >= 0.) || _unur_FP_is_infinity(lambda)) {
+	_unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"HR not valid");
+	*n_events = n;
+	return UNUR_ERR_GEN_CONDITION;
+      }
+      if (_unur_iszero(lambda)) {
+	/* no events in this piece */
+	t = b;
+	continue;
+      }
+    }
+
+    if (E > (b - t) * lambda) {
+      /* spacing exceeds current piece:
+	 the remaining part is used in the next piece (memoryless) */
+      E -= (b - t) * lambda;
+      t = b;
+      continue;
+    }
+
+    /* next candidate point */
+    t += E / lambda;
+    if (t > T) break;
+
+    /* thinning */
+    if ( lambda * _unur_call_urng(gen->urng) <= HR(t) ) {
+      if (n >= size) { *n_events = n; return UNUR_ERR_GEN_SAMPLING; }
+      times[n++] = t;
+    }
+
+    /* next exponential spacing */
+    E = _unur_hr_spacings_next(gen,&(GEN->spacings));
+  }
+
+  *n_events = n;
+  return UNUR_SUCCESS;
+
+} /* end of _unur_hri_sample_nhpp() */
+
 /*****************************************************************************/
 /**  Auxilliary Routines                                                    **/
 /*****************************************************************************/
@@ -97,6 +97,10 @@
       Notice that the parameter @i{p0} which has been set by a unur_hri_set_p0()
       call cannot be changed and must be valid for the changed distribution.
 
+      All event times of the (non-homogeneous) Poisson process or the
+      renewal process with the given hazard rate in some time interval
+      can be generated by a single call to unur_sample_hr_process().
+
    =END
 */
 
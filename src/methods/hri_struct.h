@@ -45,6 +45,7 @@ struct unur_hri_par {
 struct unur_hri_gen { 
   double p0;                          /* design (splitting) point            */
   double left_border;                 /* left border of domain               */
+  struct unur_hr_spacings spacings;   /* exponential spacings for NHPP       */
   double hrp0;                        /* hazard rate at p0                   */
 };
 
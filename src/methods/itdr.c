@@ -902,7 +902,10 @@ _unur_itdr_sample( struct unur_gen *gen )
   /* check arguments */
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_ITDR_GEN,UNUR_INFINITY);
 
+  _unur_stats_count(gen,sample);
+
   while (1) {
+    _unur_stats_count(gen,trial);
     /* generate point uniformly on (0,Atot) */
     U = _unur_call_urng(gen->urng) * GEN->Atot;
 
@@ -929,9 +932,11 @@ _unur_itdr_sample( struct unur_gen *gen )
       /* central region */
       X = U * GEN->bx / GEN->Ac;
       Y = _unur_call_urng(gen->urng) * GEN->by;
-      if (Y <= GEN->sy)
+      if (Y <= GEN->sy) {
 	/* squeeze acceptance */
+	_unur_stats_count(gen,squeeze);
 	return (I2O(X));
+      }
     }
 
     else {
@@ -965,6 +970,7 @@ _unur_itdr_sample( struct unur_gen *gen )
     X = I2O(X);
 
     /* accept or reject */
+    _unur_stats_count(gen,pdf);
     if (Y <= PDFo(X))
       return X;
   }
@@ -53,6 +53,7 @@
 #include "x_gen_source.h"
 #include "dgt.h"
 #include "dgt_struct.h"
+#include "pinv.h"
 #include "mixt.h"
 #include "mixt_struct.h"
 
@@ -60,6 +61,7 @@
 /* Variants:                                                                 */
 
 #define MIXT_VARFLAG_INVERSION   0x004u    /* use inversion method (if possible) */
+#define MIXT_VARFLAG_FUSED       0x008u    /* use single table for mixture   */
 
 /*---------------------------------------------------------------------------*/
 /* Debugging flags                                                           */
@@ -72,6 +74,12 @@
 /* Flags for logging set calls                                               */
 
 #define MIXT_SET_USEINVERSION     0x001u    /* use inverion method            */
+#define MIXT_SET_FUSED            0x002u    /* use single table for mixture   */
+
+/*---------------------------------------------------------------------------*/
+
+#define MIXT_FUSED_IVS_PER_COMP   (100)     /* max. number of intervals for   */
+                                            /* fused table per component      */
 
 /*---------------------------------------------------------------------------*/
 
@@ -114,6 +122,11 @@ static double _unur_mixt_sample_inv( struct unur_gen *gen );
 /* sample from generator by inversion                                        */
 /*---------------------------------------------------------------------------*/
 
+static double _unur_mixt_sample_fused( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* sample from generator by inversion using a single table for mixture       */
+/*---------------------------------------------------------------------------*/
+
 static struct unur_gen *_unur_mixt_indexgen( const double *prob, int n_prob );
 /*---------------------------------------------------------------------------*/
 /* create generator for index.                                               */
@@ -124,6 +137,16 @@ static int _unur_mixt_get_boundary( struct unur_gen *gen );
 /* compute boundary of mixture and check for overlapping domains.            */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_mixt_make_fused( struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* create table for inverse CDF of the mixture (method PINV).                */
+/*---------------------------------------------------------------------------*/
+
+static double _unur_mixt_fused_pdf( double x, const struct unur_distr *distr );
+/*---------------------------------------------------------------------------*/
+/* PDF of mixture (used for creating fused table).                           */
+/*---------------------------------------------------------------------------*/
+
 #ifdef UNUR_ENABLE_LOGGING
 /*---------------------------------------------------------------------------*/
 /* the following functions print debugging information on output stream,     */
@@ -165,8 +188,9 @@ static void _unur_mixt_info( struct unur_gen *gen, int help );
 /*---------------------------------------------------------------------------*/
 
 #define _unur_mixt_getSAMPLE(gen) \
-   ( ((gen)->variant & MIXT_VARFLAG_INVERSION) \
-     ? _unur_mixt_sample_inv : _unur_mixt_sample )
+   ( ((gen)->variant & MIXT_VARFLAG_FUSED) ? _unur_mixt_sample_fused : \
+     ( ((gen)->variant & MIXT_VARFLAG_INVERSION) \
+       ? _unur_mixt_sample_inv : _unur_mixt_sample ) )
 
 /*---------------------------------------------------------------------------*/
 
@@ -263,6 +287,40 @@ unur_mixt_set_useinversion( struct unur_par *par, int useinversion )
 
 } /* end of unur_mixt_set_useinversion() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+unur_mixt_set_fused( struct unur_par *par, int fused )
+     /*----------------------------------------------------------------------*/
+     /* set flag for using a single table for the inverse CDF of mixture     */
+     /* (default: off)                                                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   par   ... pointer to parameter for building generator object       */
+     /*   fused ... !0 = use single table,  0 = sample from components       */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, MIXT );
+
+  /* we use a bit in 'variant' */
+  par->variant = (fused)
+    ? (par->variant | MIXT_VARFLAG_FUSED)
+    : (par->variant & (~MIXT_VARFLAG_FUSED));
+
+  /* changelog */
+  par->set |= MIXT_SET_FUSED;
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+
+} /* end of unur_mixt_set_fused() */
+
 
 /*****************************************************************************/
 /**  Private                                                                **/
@@ -321,6 +379,11 @@ _unur_mixt_init( struct unur_par *par )
     _unur_mixt_free(gen); return NULL;
   }
 
+  /* create table for inverse CDF of mixture */
+  if ( GEN->is_fused && _unur_mixt_make_fused(gen) != UNUR_SUCCESS ) {
+    _unur_mixt_free(gen); return NULL;
+  }
+
   /* set name of distribution */
   unur_distr_set_name(gen->distr, "(mixture)");
 
@@ -374,9 +437,12 @@ _unur_mixt_create( struct unur_par *par )
   gen->reinit = NULL;    /* reinit not implemented ! */
 
   /* copy some parameters into generator object */
-  GEN->is_inversion = (gen->variant & MIXT_VARFLAG_INVERSION) ? TRUE : FALSE;
+  GEN->is_fused = (gen->variant & MIXT_VARFLAG_FUSED) ? TRUE : FALSE;
+  GEN->is_inversion = (GEN->is_fused || (gen->variant & MIXT_VARFLAG_INVERSION)) ? TRUE : FALSE;
 
-  /* initialize parameters: none */
+  /* initialize parameters */
+  GEN->weight = NULL;
+  GEN->fused = NULL;
 
 #ifdef UNUR_ENABLE_INFO
   /* set function for creating info string */
@@ -430,6 +496,16 @@ _unur_mixt_check_par( struct unur_gen *gen )
       return UNUR_ERR_GEN_INVALID;
     }
 
+    /* a single table requires the PDFs of all components */
+    if (GEN->is_fused) {
+      if ( gen->COMP[i]->distr->type != UNUR_DISTR_CONT ||
+	   gen->COMP[i]->distr->data.cont.pdf == NULL ) {
+	_unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"component has no PDF");
+	return UNUR_ERR_GEN_INVALID;
+      }
+      continue;
+    }
+
     /* we only can use inversion method if all generators use inversion method */
     if (GEN->is_inversion && (! unur_gen_is_inversion (gen->COMP[i]))) {
       _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"component does not implement inversion");
@@ -467,6 +543,17 @@ _unur_mixt_clone( const struct unur_gen *gen )
   /* create generic clone */
   clone = _unur_generic_clone( gen, GENTYPE );
 
+  /* copy table for mixture */
+  if (GEN->weight) {
+    CLONE->weight = _unur_xmalloc( gen->N_COMP * sizeof(double) );
+    memcpy( CLONE->weight, GEN->weight, gen->N_COMP * sizeof(double) );
+  }
+  if (GEN->fused) {
+    CLONE->fused = _unur_gen_clone( GEN->fused );
+    /* PDF of mixture must use components of clone */
+    CLONE->fused->distr->extobj = clone;
+  }
+
   return clone;
 
 #undef CLONE
@@ -497,6 +584,8 @@ _unur_mixt_free( struct unur_gen *gen )
   SAMPLE = NULL;   /* make sure to show up a programming error */
 
   /* free memory */
+  if (GEN->fused) _unur_free(GEN->fused);
+  if (GEN->weight) free(GEN->weight);
   _unur_generic_free(gen);
 
 } /* end of _unur_mixt_free() */
@@ -582,6 +671,36 @@ _unur_mixt_sample_inv( struct unur_gen *gen )
 
 /*---------------------------------------------------------------------------*/
 
+double
+_unur_mixt_sample_fused( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* sample from generator by inversion using single table for mixture    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   double (sample from random variate)                                */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return UNUR_INFINITY                                               */
+     /*----------------------------------------------------------------------*/
+{
+  double U;
+
+  /* check arguments */
+  CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_MIXT_GEN,UNUR_INFINITY);
+
+  /* sample from U(0,1) */
+  U = _unur_call_urng(gen->urng);
+
+  /* use table for approximate inverse CDF of mixture */
+  return unur_pinv_eval_approxinvcdf( GEN->fused, U );
+
+} /* end of _unur_mixt_sample_fused() */
+
+/*---------------------------------------------------------------------------*/
+
 double
 unur_mixt_eval_invcdf( const struct unur_gen *gen, double u )
      /*----------------------------------------------------------------------*/
@@ -618,6 +737,10 @@ unur_mixt_eval_invcdf( const struct unur_gen *gen, double u )
     return u;  /* = NaN */
   }
 
+  /* use table for mixture */
+  if (GEN->is_fused)
+    return unur_pinv_eval_approxinvcdf( GEN->fused, u );
+
   /* get index */
   J =unur_dgt_eval_invcdf_recycle( gen->INDEX, u, &recycle );
 
@@ -730,7 +853,7 @@ _unur_mixt_get_boundary( struct unur_gen *gen )
   }
 
   /* overlap or unordered domains? */
-  if (GEN->is_inversion && overlap) {
+  if (GEN->is_inversion && !GEN->is_fused && overlap) {
     _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"domains of components overlap or are unsorted");
     return UNUR_ERR_GEN_INVALID;
   }
@@ -742,6 +865,97 @@ _unur_mixt_get_boundary( struct unur_gen *gen )
   return UNUR_SUCCESS;
 } /* end of _unur_mixt_get_boundary() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_mixt_make_fused( struct unur_gen *gen )
+/*---------------------------------------------------------------------------*/
+/* create table for inverse CDF of the mixture.                              */
+/* we use method PINV for the PDF of the mixture, i.e., the weighted sum of  */
+/* the (normalized) PDFs of the components.                                  */
+/*                                                                           */
+/* parameters:                                                               */
+/*   gen ... pointer to generator object                                     */
+/*                                                                           */
+/* return:                                                                   */
+/*   UNUR_SUCCESS ... when everything is o.k.                                */
+/*   error code   ... on error                                               */
+/*---------------------------------------------------------------------------*/
+{
+  struct unur_distr *distr;
+  struct unur_par *par;
+  double area, sum, pmax;
+  int i, imax, max_ivs;
+
+  /* weights for PDFs of components: p_i / area_i */
+  sum = ((struct unur_dgt_gen*)gen->INDEX->datap)->sum;
+  GEN->weight = _unur_xmalloc( gen->N_COMP * sizeof(double) );
+  imax = 0; pmax = -1.;
+  for (i=0; i<gen->N_COMP; i++) {
+    area = unur_distr_cont_get_pdfarea(gen->COMP[i]->distr);
+    if (!_unur_isfinite(area) || !(area > 0.)) {
+      _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"area below PDF of component");
+      return UNUR_ERR_GEN_DATA;
+    }
+    GEN->weight[i] = gen->PROB[i] / (sum * area);
+    /* component with largest probability provides center of mixture */
+    if (gen->PROB[i] > pmax) { pmax = gen->PROB[i]; imax = i; }
+  }
+
+  /* distribution object for mixture */
+  distr = unur_distr_cont_new();
+  unur_distr_cont_set_pdf(distr, _unur_mixt_fused_pdf);
+  unur_distr_cont_set_domain(distr, DISTR.domain[0], DISTR.domain[1]);
+  unur_distr_cont_set_center(distr, unur_distr_cont_get_center(gen->COMP[imax]->distr));
+  unur_distr_cont_set_pdfarea(distr, 1.);
+  unur_distr_set_extobj(distr, gen);
+
+  /* create generator object */
+  max_ivs = _unur_max(10000, MIXT_FUSED_IVS_PER_COMP * gen->N_COMP);
+  par = unur_pinv_new(distr);
+  unur_pinv_set_max_intervals(par, _unur_min(max_ivs,1000000));
+  GEN->fused = unur_init(par);
+  unur_distr_free(distr);
+
+  if (GEN->fused == NULL) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"cannot create table for mixture");
+    return UNUR_ERR_GEN_CONDITION;
+  }
+
+  /* o.k. */
+  return UNUR_SUCCESS;
+} /* end of _unur_mixt_make_fused() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_mixt_fused_pdf( double x, const struct unur_distr *distr )
+/*---------------------------------------------------------------------------*/
+/* PDF of mixture.                                                           */
+/*                                                                           */
+/* parameters:                                                               */
+/*   x     ... argument for PDF                                              */
+/*   distr ... pointer to distribution object                                */
+/*                                                                           */
+/* return:                                                                   */
+/*   PDF of mixture at x                                                     */
+/*---------------------------------------------------------------------------*/
+{
+  const struct unur_gen *gen = distr->extobj;
+  const struct unur_distr *cdistr;
+  double fx = 0.;
+  int i;
+
+  for (i=0; i<gen->N_COMP; i++) {
+    cdistr = gen->COMP[i]->distr;
+    if (x < cdistr->data.cont.BD_LEFT || x > cdistr->data.cont.BD_RIGHT)
+      continue;
+    fx += GEN->weight[i] * _unur_cont_PDF(x,cdistr);
+  }
+
+  return fx;
+} /* end of _unur_mixt_fused_pdf() */
+
 
 /*****************************************************************************/
 /**  Debugging utilities                                                    **/
@@ -777,12 +991,19 @@ _unur_mixt_debug_init( const struct unur_gen *gen )
   _unur_distr_cont_debug( gen->distr, gen->genid );
 
   fprintf(LOG,"%s: sampling routine = _unur_mixt_sample",gen->genid);
-  if (GEN->is_inversion) fprintf(LOG,"_inv");
+  if (GEN->is_fused) fprintf(LOG,"_fused");
+  else if (GEN->is_inversion) fprintf(LOG,"_inv");
   fprintf(LOG,"()\n%s:\n",gen->genid);
 
   fprintf(LOG,"%s: use inversion = %s",gen->genid,
 	  (GEN->is_inversion) ? "on" : "off");
   _unur_print_if_default(gen,MIXT_SET_USEINVERSION);
+  fprintf(LOG,"\n%s: use single table for mixture = %s",gen->genid,
+	  (GEN->is_fused) ? "on" : "off");
+  _unur_print_if_default(gen,MIXT_SET_FUSED);
+  if (GEN->is_fused)
+    fprintf(LOG,"\n%s:\t[%s: %d intervals]",gen->genid,
+	    GEN->fused->genid, unur_pinv_get_n_intervals(GEN->fused));
   fprintf(LOG,"\n%s:\n",gen->genid);
 
   /* probabilities */
@@ -878,13 +1099,23 @@ _unur_mixt_info( struct unur_gen *gen, int help )
 
   /* method */
   _unur_string_append(info,"method: MIXT (MIXTure of distributions -- meta method)\n");
-  _unur_string_append(info,"   select component = method DGT\n");
+  if (GEN->is_fused) {
+    _unur_string_append(info,"   single table for mixture = method PINV\n");
+  }
+  else {
+    _unur_string_append(info,"   select component = method DGT\n");
+  }
   _unur_string_append(info,"   inversion method = %s\n",
 		      (GEN->is_inversion) ? "TRUE" : "FALSE");
   _unur_string_append(info,"\n");
 
   /* performance */
-  _unur_string_append(info,"performance characteristics: depends on components\n");
+  if (GEN->is_fused) {
+    _unur_string_append(info,"performance characteristics:\n");
+    _unur_string_append(info,"   # intervals = %d\n", unur_pinv_get_n_intervals(GEN->fused));
+  }
+  else
+    _unur_string_append(info,"performance characteristics: depends on components\n");
   _unur_string_append(info,"\n");
 
   /* parameters */
@@ -895,6 +1126,11 @@ _unur_mixt_info( struct unur_gen *gen, int help )
       _unur_string_append(info,"on\n");
     else
       _unur_string_append(info,"off  [default]\n");
+    _unur_string_append(info,"   fused = ");
+    if (gen->variant & MIXT_VARFLAG_FUSED)
+      _unur_string_append(info,"on\n");
+    else
+      _unur_string_append(info,"off  [default]\n");
   }
 
 } /* end of _unur_mixt_info() */
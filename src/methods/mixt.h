@@ -83,6 +83,21 @@
       @item
       The components must be ordered with respect to their domains.
       @end itemize
+
+      Alternatively, the mixture can be sampled by inversion using a
+      single table for its inverse CDF.
+      Then the PDF of the mixture, i.e., the weighted sum of the PDFs
+      of the components, is used to compute a table of interpolating
+      polynomials by means of method PINV
+      (@pxref{PINV,Polynomial interpolation based INVersion of CDF}).
+      Sampling then requires just a single table lookup and the
+      evaluation of a polynomial independent of the number of
+      components.
+      This variant requires that all components are continuous
+      distributions with given PDF and known area below the PDF
+      (e.g., standard distributions). The domains may overlap.
+      The setup is slower, in particular for mixtures with many
+      components.
       
    =HOWTOUSE
       Create generator objects for the components of the mixture and
@@ -105,6 +120,9 @@
       unur_mixt_set_useinversion() call.
       However, the conditions for this method must then be met. 
       Otherwise, initialization of the mixture object fails.
+
+      For large samples a single table for the inverse CDF of the
+      mixture can be used by means of a unur_mixt_set_fused() call.
       
    =END
 */
@@ -149,6 +167,32 @@ int unur_mixt_set_useinversion( UNUR_PAR *parameters, int useinv );
    Default is FALSE.
 */
 
+int unur_mixt_set_fused( UNUR_PAR *parameters, int fused );
+/* 
+   If @var{fused} is TRUE, then a single table for the inverse CDF of
+   the mixture distribution is computed using method PINV and used
+   for sampling. The generator objects of the components are then
+   only used to get the PDFs of the components and not for sampling.
+   The resulting generator object implements an inversion method.
+
+   The following conditions must be satisfied:
+
+   @itemize @minus
+   @item
+   All components must be continuous distributions where the PDF is
+   given.
+   @item
+   The area below each of these PDFs must be known or computable,
+   see unur_distr_cont_get_pdfarea().
+   @end itemize
+
+   The domains of the components may overlap.
+   If one of these conditions is violated or the PINV table cannot be
+   computed, then initialization of the mixture object fails.
+
+   Default is FALSE.
+*/
+
 /* =END */
 
 /*---------------------------------------------------------------------------*/
@@ -46,6 +46,9 @@ struct unur_mixt_par {
 
 struct unur_mixt_gen { 
   int is_inversion;             /* whether inversion is used                 */
+  int is_fused;                 /* whether single table for mixture is used  */
+  double *weight;               /* weights for PDFs of components            */
+  struct unur_gen *fused;       /* generator (PINV) for mixture              */
 
   /* components are stored in slot 'gen_aux_list'                            */
   /* probabilities are stored in slot 'gen_aux' as generator with method DGT */
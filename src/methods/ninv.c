@@ -107,6 +107,16 @@
 /* univariate random numbers (must be > 0. and < 1.)                         */
 #define INTERVAL_COVERS  (0.5)
 
+/* Random variates are generated in blocks of this size when an array of     */
+/* random variates is sampled (Newton's method only).                        */
+#define NINV_BLOCKSIZE  (64)
+
+/* Bounds for the number of points in the table of starting points when its */
+/* size is computed automatically for the spline interpolation.              */
+#define NINV_SPLINE_TABLE_MIN  (10)
+#define NINV_SPLINE_TABLE_MAX  (1000)
+#define NINV_SPLINE_TABLE_DEFAULT  (100)  /* when u-resolution is disabled  */
+
 /*---------------------------------------------------------------------------*/
 /* Variants: none                                                            */
 
@@ -133,6 +143,7 @@
 #define NINV_SET_X_RESOLUTION 0x002u   /* maximal tolerated relative x-error */
 #define NINV_SET_U_RESOLUTION 0x004u   /* maximal tolerated (abs.) u-error   */
 #define NINV_SET_START        0x008u   /* intervals at start (left/right)    */
+#define NINV_SET_SPLINE       0x010u   /* spline interpolation of table      */
 
 /*---------------------------------------------------------------------------*/
 
@@ -181,6 +192,11 @@ static void _unur_ninv_free( struct unur_gen *gen );
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_ninv_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_ninv_create_table( struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* create the table with starting points                                     */
@@ -191,6 +207,11 @@ static int _unur_ninv_compute_start( struct unur_gen *gen );
 /* get starting points for numerical inversion                               */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_ninv_spline_table_size( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* compute size of table for spline interpolation of starting points.        */
+/*---------------------------------------------------------------------------*/
+
 
 /*........................*/
 /*  file: ninv_sample.ch  */
@@ -203,6 +224,11 @@ static double _unur_ninv_sample_bisect( struct unur_gen *gen );
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_ninv_sample_array_newton( struct unur_gen *gen, double *X, int n );
+/*---------------------------------------------------------------------------*/
+/* sample array of random variates from generator (Newton's method).         */
+/*---------------------------------------------------------------------------*/
+
 
 /*........................*/
 /*  file: ninv_newton.ch  */
@@ -213,6 +239,16 @@ static double _unur_ninv_newton( const struct unur_gen *gen, double u);
 /* algorithm: newton method                                                  */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_ninv_newton_array( const struct unur_gen *gen, double *X, int n );
+/*---------------------------------------------------------------------------*/
+/* algorithm: newton method for a block of uniform random numbers.           */
+/*---------------------------------------------------------------------------*/
+
+static double _unur_ninv_newton_start( const struct unur_gen *gen, double u, double *fx );
+/*---------------------------------------------------------------------------*/
+/* get starting point for newton method.                                     */
+/*---------------------------------------------------------------------------*/
+
 
 /*........................*/
 /*  file: ninv_regula.ch  */
@@ -297,6 +333,7 @@ static void _unur_ninv_info( struct unur_gen *gen, int help );
 #define DISTR     gen->distr->data.cont /* data for distribution in generator object */
 
 #define SAMPLE    gen->sample.cont      /* pointer to sampling routine       */
+#define SAMPLE_ARRAY  gen->sample_array.cont  /* pointer to routine for arrays */
 
 #define PDF(x)    _unur_cont_PDF((x),(gen->distr))    /* call to PDF         */
 #define CDF(x)    _unur_cont_CDF((x),(gen->distr))    /* call to CDF         */
@@ -319,6 +356,11 @@ _unur_ninv_getSAMPLE( struct unur_gen *gen )
 
 /*---------------------------------------------------------------------------*/
 
+#define _unur_ninv_getSAMPLE_ARRAY(gen) \
+   ( ((gen)->variant == NINV_VARFLAG_NEWTON) ? _unur_ninv_sample_array_newton : NULL )
+
+/*---------------------------------------------------------------------------*/
+
 
 /*---------------------------------------------------------------------------*/
 /* since there is only file scope or program code, we abuse the              */
@@ -97,6 +97,15 @@
       As a rule of thumb using such a table is appropriate when the
       number of generated points exceeds the table size by a factor of
       100.
+
+      For Newton's method the table can be combined with a monotone
+      cubic spline interpolation of the inverse CDF, see
+      unur_ninv_set_spline(). Then fast generation of large samples
+      by means of unur_sample_cont_array() is possible, where Newton's
+      method is run for blocks of uniform random numbers
+      simultaneously. This is an alternative to method PINV when the
+      setup of the latter is too expensive or when its accuracy is not
+      sufficient.
   
       The default number of iterations of NINV should be enough for all
       reasonable cases. Nevertheless, it is possible to adjust the maximal
@@ -269,6 +278,25 @@ int unur_ninv_chg_table(UNUR_GEN *gen, int no_of_points);
    Recomputes a table as described in unur_ninv_set_table().
 */
 
+int unur_ninv_set_spline(UNUR_PAR *parameters, int spline);
+/* 
+   If @var{spline} is TRUE, the starting point for Newton's method is
+   computed by monotone cubic Hermite interpolation of the inverse CDF
+   at the points of the table of starting values (see
+   unur_ninv_set_table()). This interpolation is rather accurate
+   such that usually only one or two Newton steps are required to
+   reach the accuracy goal, at the expense of one additional
+   evaluation of the CDF.
+
+   If the size of the table has not been set by a
+   unur_ninv_set_table() call, then it is computed from the
+   u-resolution (see unur_ninv_set_u_resolution()).
+   The spline is only used together with Newton's method
+   (see unur_ninv_set_usenewton()).
+
+   By default no spline interpolation is used.
+*/
+
 
 int unur_ninv_chg_truncated(UNUR_GEN *gen, double left, double right);
 /*
@@ -42,6 +42,7 @@ struct unur_ninv_par {
   double  s[2];              /* interval boundaries at start (left/right)    */
   int     table_on;          /* if TRUE a table for starting points is used  */
   int     table_size;        /* size of table                                */
+  int     spline_on;         /* if TRUE use spline interpolation of table    */
 };
 
 /*---------------------------------------------------------------------------*/
@@ -53,8 +54,10 @@ struct unur_ninv_gen {
   double  u_resolution;      /* maximal tolerated (absolute) u-error         */
   double *table;             /* table with possible starting values for NINV */
   double *f_table;	     /* function values of points stored in table    */
+  double *dx_table;          /* derivatives of inverse CDF at table points   */
   int     table_on;          /* if TRUE a table for starting points is used  */
   int     table_size;        /* size of table                                */
+  int     spline_on;         /* if TRUE use spline interpolation of table    */
   double  Umin, Umax;        /* bounds for iid random variable in respect to
                                 the given (truncated) domain of the distr.   */
   double  CDFmin, CDFmax;    /* CDF-bounds of domain                         */
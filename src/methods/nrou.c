@@ -744,7 +744,10 @@ _unur_nrou_sample( struct unur_gen *gen )
   /* check arguments */
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_NROU_GEN,UNUR_INFINITY);
 
+  _unur_stats_count(gen,sample);
+
   while (1) {
+    _unur_stats_count(gen,trial);
     /* generate point uniformly on rectangle */
     while ( _unur_iszero(V = _unur_call_urng(gen->urng)) );
     V *= GEN->vmax;
@@ -761,6 +764,7 @@ _unur_nrou_sample( struct unur_gen *gen )
       continue;
 
     /* accept or reject */
+    _unur_stats_count(gen,pdf);
     if (_unur_isone(GEN->r)) {
       /* normal rou-method with square-root */
       if (V*V <= PDF(X)) 
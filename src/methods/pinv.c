@@ -288,6 +288,11 @@ static void _unur_pinv_free (struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_pinv_memsize (const struct unur_gen *gen);
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_pinv_make_guide_table (struct unur_gen *gen);
 /*---------------------------------------------------------------------------*/
 /* make a guide table for indexed search.                                    */
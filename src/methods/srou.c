@@ -967,7 +967,10 @@ _unur_srou_sample( struct unur_gen *gen )
   /* check arguments */
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_SROU_GEN,UNUR_INFINITY);
 
+  _unur_stats_count(gen,sample);
+
   while (1) {
+    _unur_stats_count(gen,trial);
     /* generate point uniformly on rectangle */
     while ( _unur_iszero(U = _unur_call_urng(gen->urng)) );
     U *= GEN->um;
@@ -989,11 +992,14 @@ _unur_srou_sample( struct unur_gen *gen )
 	 (X <= GEN->xr ) && 
 	 (U < GEN->um) ) {
       xx = V / (GEN->um - U);
-      if ( (xx >= GEN->xl) && (xx <= GEN->xr ) )
+      if ( (xx >= GEN->xl) && (xx <= GEN->xr ) ) {
+	_unur_stats_count(gen,squeeze);
 	return x;
+      }
     }
 
     /* accept or reject */
+    _unur_stats_count(gen,pdf);
     if (U*U <= PDF(x))
       return x;
   }
@@ -1022,7 +1028,10 @@ _unur_srou_sample_mirror( struct unur_gen *gen )
   /* check arguments */
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_SROU_GEN,UNUR_INFINITY);
 
+  _unur_stats_count(gen,sample);
+
   while (1) {
+    _unur_stats_count(gen,trial);
     /* generate point uniformly on rectangle */
     while ( _unur_iszero(U = _unur_call_urng(gen->urng)) );
     U *= GEN->um * SQRT2;
@@ -1034,6 +1043,7 @@ _unur_srou_sample_mirror( struct unur_gen *gen )
 
     /* evaluate PDF */
     x = X + DISTR.mode;
+    _unur_stats_count(gen,pdf);
     fx  = (x < DISTR.BD_LEFT || x > DISTR.BD_RIGHT) ? 0. : PDF(x);
     uu = U * U;
 
@@ -1043,6 +1053,7 @@ _unur_srou_sample_mirror( struct unur_gen *gen )
 
     /* try mirrored PDF */
     x = -X + DISTR.mode;
+    _unur_stats_count(gen,pdf);
     fnx  = (x < DISTR.BD_LEFT || x > DISTR.BD_RIGHT) ? 0. : PDF(x);
     if (uu <= fx + fnx)
       return x;
@@ -168,6 +168,11 @@ static void _unur_tabl_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_tabl_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_tabl_rh_sample( struct unur_gen *gen );
 static double _unur_tabl_rh_sample_check( struct unur_gen *gen );
 static double _unur_tabl_ia_sample( struct unur_gen *gen );
@@ -342,6 +342,10 @@
 /*---------------------------------------------------------------------------*/
 /* Constants                                                                 */
 
+/* Random variates are generated in blocks of this size when an array of     */
+/* random variates is sampled (variant PS only).                             */
+#define TDR_BLOCKSIZE  (64)
+
 /*---------------------------------------------------------------------------*/
 /* Variants                                                                  */
 
@@ -427,6 +431,11 @@ static double _unur_tdr_ia_sample_check( struct unur_gen *generator );
 /* sample from generator                                                     */
 /*---------------------------------------------------------------------------*/
 
+static int _unur_tdr_ps_sample_array( struct unur_gen *generator, double *X, int n );
+/*---------------------------------------------------------------------------*/
+/* sample array of random variates from generator (squeeze test first).      */
+/*---------------------------------------------------------------------------*/
+
 static double _unur_tdr_gw_eval_invcdfhat( const struct unur_gen *generator, double u,
 					   double *hx, double *fx, double *sqx,
 					   struct unur_tdr_interval **iv,
@@ -443,6 +452,11 @@ static void _unur_tdr_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_tdr_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static struct unur_gen *_unur_tdr_clone( const struct unur_gen *gen );
 /*---------------------------------------------------------------------------*/
 /* copy (clone) generator object.                                            */
@@ -635,6 +649,7 @@ static void _unur_tdr_info( struct unur_gen *gen, int help );
 #define BD_RIGHT  domain[1]             /* right boundary of domain of distribution */
 
 #define SAMPLE    gen->sample.cont      /* pointer to sampling routine       */     
+#define SAMPLE_ARRAY  gen->sample_array.cont  /* pointer to routine for arrays */
 
 #define PDF(x)     _unur_cont_PDF((x),(gen->distr))      /* call to PDF      */
 #define dPDF(x)    _unur_cont_dPDF((x),(gen->distr))     /* call to derivative of PDF */
@@ -657,6 +672,12 @@ _unur_tdr_getSAMPLE( struct unur_gen *gen )
   }
 } /* end of _unur_tdr_getSAMPLE() */
 
+/*---------------------------------------------------------------------------*/
+
+#define _unur_tdr_getSAMPLE_ARRAY(gen) \
+   ( ( ((gen)->variant & TDR_VARMASK_VARIANT) == TDR_VARIANT_PS && \
+       !((gen)->variant & TDR_VARFLAG_VERIFY) ) ? _unur_tdr_ps_sample_array : NULL )
+
 /*---------------------------------------------------------------------------*/
 /* since there is only file scope or program code, we abuse the              */
 /* #include directive.                                                       */
@@ -111,6 +111,19 @@
       @item IA ... 1
       @end table
       
+      For variant PS there exists a special routine for sampling
+      arrays of random variates by means of unur_sample_cont_array().
+      Candidates for a block of random variates are first tested
+      against the squeeze and the PDF is only evaluated for the
+      (few) remaining candidates. Thus it is faster for expensive
+      PDFs. Notice, however, that it is only used when the hat
+      function is not improved any more during sampling, i.e.,
+      when the maximum number of intervals is reached or when the
+      ratio between the area below squeeze and hat is already
+      large enough (see unur_tdr_set_max_sqhratio()).
+      The resulting sequence of random variates differs from that
+      of repeated calls to unur_sample_cont().
+
       There exists a test mode that verifies whether the conditions for
       the method are satisfied or not. It can be switched on by calling 
       unur_tdr_set_verify() and unur_tdr_chg_verify(), respectively.
@@ -65,6 +65,14 @@
     return rval; } \
   COOKIE_CHECK((gen),CK_##type##_GEN,UNUR_ERR_COOKIE)
 
+/*---------------------------------------------------------------------------*/
+/* check if generator object is shared by sampling contexts or is a sampling */
+/* context (see unur_gen_share()). Then its tables must not be changed.      */
+#define _unur_check_gen_not_shared( gen,rval ) \
+  if ( (gen)->n_contexts > 0 || (gen)->core != NULL ) { \
+    _unur_error((gen)->genid,UNUR_ERR_GEN_INVALID,"generator object is shared by sampling contexts"); \
+    return rval; }
+
 /*---------------------------------------------------------------------------*/
 #endif  /* UNUR_METHODS_SOURCE_H_SEEN */
 /*---------------------------------------------------------------------------*/
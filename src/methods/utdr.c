@@ -827,7 +827,10 @@ _unur_utdr_sample( struct unur_gen *gen )
   /* check arguments */
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_UTDR_GEN,UNUR_INFINITY);
 
+  _unur_stats_count(gen,sample);
+
   while (1) {
+    _unur_stats_count(gen,trial);
     /*2*/
     u = _unur_call_urng(gen->urng) * GEN->volcompl;
     /*2.1*/
@@ -854,15 +857,16 @@ _unur_utdr_sample( struct unur_gen *gen )
     if (x<DISTR.mode) {
       if (x >= GEN->ttlx) {
 	help = GEN->hm - (DISTR.mode - x) * GEN->sal;
-	if (v * help * help <= 1.) return x;
+	if (v * help * help <= 1.) { _unur_stats_count(gen,squeeze); return x; }
       } 
     }
     else {
       if (x <= GEN->ttrx) {
 	help = GEN->hm - (DISTR.mode - x) * GEN->sar;
-	if (v * help * help <= 1.) return x; 
+	if (v * help * help <= 1.) { _unur_stats_count(gen,squeeze); return x; }
       }
     }
+    _unur_stats_count(gen,pdf);
     if (v <= PDF(x)) return x; 
   }
 
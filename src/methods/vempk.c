@@ -174,6 +174,11 @@ static void _unur_vempk_free( struct unur_gen *gen);
 /* destroy generator object.                                                 */
 /*---------------------------------------------------------------------------*/
 
+static size_t _unur_vempk_memsize( const struct unur_gen *gen );
+/*---------------------------------------------------------------------------*/
+/* memory used by tables.                                                    */
+/*---------------------------------------------------------------------------*/
+
 static int _unur_vempk_sample_cvec( struct unur_gen *gen, double *result );
 /*---------------------------------------------------------------------------*/
 /* sample from generator                                                     */
@@ -564,6 +569,7 @@ _unur_vempk_create( struct unur_par *par )
   SAMPLE = _unur_vempk_getSAMPLE(gen);
   gen->destroy = _unur_vempk_free;
   gen->clone = _unur_vempk_clone;
+  gen->memsize = _unur_vempk_memsize;
 
   /* copy some parameters into generator object */
   GEN->smoothing = PAR->smoothing;    /* smoothing factor                      */
@@ -658,6 +664,21 @@ _unur_vempk_free( struct unur_gen *gen )
 
 } /* end of _unur_vempk_free() */
 
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_vempk_memsize( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* compute number of bytes used by tables                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  /* mean vector of sample */
+  return ((GEN->xbar) ? GEN->dim * sizeof(double) : 0);
+} /* end of _unur_vempk_memsize() */
+
 /*****************************************************************************/
 
 int
@@ -33,18 +33,34 @@
 /*---------------------------------------------------------------------------*/
 
 #include <unur_source.h>
+#include <distr/distr.h>
 #include <distr/distr_source.h>
+#include <distr/cont.h>
 #include <distr/matr.h>
+#include <methods/arou.h>
+#include <methods/arou_struct.h>
+#include <methods/ars.h>
+#include <methods/ars_struct.h>
 #include <methods/cstd.h>
 #include <methods/cstd_struct.h>
+#include <methods/dari.h>
+#include <methods/dari_struct.h>
 #include <methods/dgt.h>
+#include <methods/dgt_struct.h>
 #include <methods/dstd.h>
 #include <methods/dstd_struct.h>
+#include <methods/gibbs.h>
 #include <methods/hinv.h>
+#include <methods/hitro.h>
 #include <methods/mixt.h>
 #include <methods/mixt_struct.h>
 #include <methods/ninv.h>
 #include <methods/pinv.h>
+#include <methods/tabl.h>
+#include <methods/tabl_struct.h>
+#include <methods/tdr.h>
+#include <methods/tdr_struct.h>
+#include <urng/urng.h>
 #include "unur_methods_source.h"
 #include "x_gen.h"
 #include "x_gen_source.h"
@@ -61,8 +77,15 @@
 
 struct unur_gen *unur_init( struct unur_par *par )
 {                
+  struct unur_gen *gen;
+
   _unur_check_NULL(NULL,par,NULL);
-  return (par->init(par));
+  gen = par->init(par);
+
+  /* the cache for PDF values is only used during setup */
+  if (gen) _unur_gen_remove_pdfcache(gen);
+
+  return gen;
 } /* end of unur_init() */
 
 /*---------------------------------------------------------------------------*/
@@ -72,6 +95,9 @@ int unur_reinit( struct unur_gen *gen )
   int status = UNUR_SUCCESS;
   _unur_check_NULL(NULL,gen,UNUR_ERR_NULL);
 
+  /* tables must not be changed while they are shared */
+  _unur_check_gen_not_shared( gen, UNUR_ERR_GEN_INVALID );
+
   if (gen->reinit) {
     status = gen->reinit(gen);
     if (status == UNUR_SUCCESS) return status;
@@ -82,6 +108,7 @@ int unur_reinit( struct unur_gen *gen )
   }
 
   /* error: change sampling routine */
+  gen->sample_array.cont = NULL;
   switch (gen->method & UNUR_MASK_TYPE) {
   case UNUR_METH_DISCR:
     gen->sample.discr = _unur_sample_discr_error;
@@ -116,147 +143,1317 @@ unur_sample_discr( struct unur_gen *gen )
 double
 unur_sample_cont( struct unur_gen *gen )
 {
-  CHECK_NULL(gen,UNUR_INFINITY);
-  return (gen->sample.cont(gen));
-} /* end of unur_sample_cont() */
+  CHECK_NULL(gen,UNUR_INFINITY);
+  return (gen->sample.cont(gen));
+} /* end of unur_sample_cont() */
+
+int
+unur_sample_vec( struct unur_gen *gen, double *vector )
+{
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  return (gen->sample.cvec(gen,vector));
+} /* end of unur_sample_vec() */
+
+int
+unur_sample_matr( struct unur_gen *gen, double *matrix )
+{
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  return (gen->sample.matr(gen,matrix));
+} /* end of unur_sample_matr() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_sample_cont_array( struct unur_gen *gen, double *X, int n )
+     /*----------------------------------------------------------------------*/
+     /* fill array X with n random variates                                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   X   ... pointer to array of (at least) length n                    */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,X,UNUR_ERR_NULL);
+  if ( (gen->method & UNUR_MASK_TYPE) != UNUR_METH_CONT &&
+       (gen->method & UNUR_MASK_TYPE) != UNUR_METH_CEMP ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  if (n <= 0) return UNUR_SUCCESS;
+
+  /* use special routine when available */
+  if (gen->sample_array.cont)
+    return (gen->sample_array.cont(gen,X,n));
+
+  /* else call sampling routine repeatedly */
+  for (i=0; i<n; i++)
+    X[i] = gen->sample.cont(gen);
+
+  return (gen->sample.cont == _unur_sample_cont_error) 
+    ? UNUR_ERR_GEN_CONDITION : UNUR_SUCCESS;
+
+} /* end of unur_sample_cont_array() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_sample_discr_array( struct unur_gen *gen, int *K, int n )
+     /*----------------------------------------------------------------------*/
+     /* fill array K with n random variates                                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   K   ... pointer to array of (at least) length n                    */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,K,UNUR_ERR_NULL);
+  if ( (gen->method & UNUR_MASK_TYPE) != UNUR_METH_DISCR ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  if (n <= 0) return UNUR_SUCCESS;
+
+  /* use special routine when available */
+  if (gen->sample_array.discr)
+    return (gen->sample_array.discr(gen,K,n));
+
+  /* else call sampling routine repeatedly */
+  for (i=0; i<n; i++)
+    K[i] = gen->sample.discr(gen);
+
+  return (gen->sample.discr == _unur_sample_discr_error) 
+    ? UNUR_ERR_GEN_CONDITION : UNUR_SUCCESS;
+
+} /* end of unur_sample_discr_array() */
+
+/*---------------------------------------------------------------------------*/
+/* Variance reduction for inversion methods                                  */
+
+int
+unur_sample_cont_antithetic( struct unur_gen *gen, double *X, int n )
+     /*----------------------------------------------------------------------*/
+     /* fill array X with n random variates in antithetic pairs              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   X   ... pointer to array of (at least) length n                    */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,X,UNUR_ERR_NULL);
+
+  return _unur_sample_vr(gen,X,NULL,n,UNUR_SAMPLE_VR_ANTITHETIC);
+} /* end of unur_sample_cont_antithetic() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_sample_discr_antithetic( struct unur_gen *gen, int *K, int n )
+     /*----------------------------------------------------------------------*/
+     /* fill array K with n random variates in antithetic pairs              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   K   ... pointer to array of (at least) length n                    */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,K,UNUR_ERR_NULL);
+
+  return _unur_sample_vr(gen,NULL,K,n,UNUR_SAMPLE_VR_ANTITHETIC);
+} /* end of unur_sample_discr_antithetic() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_sample_cont_stratified( struct unur_gen *gen, double *X, int n )
+     /*----------------------------------------------------------------------*/
+     /* fill array X with stratified sample of size n                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   X   ... pointer to array of (at least) length n                    */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,X,UNUR_ERR_NULL);
+
+  return _unur_sample_vr(gen,X,NULL,n,UNUR_SAMPLE_VR_STRATIFIED);
+} /* end of unur_sample_cont_stratified() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_sample_discr_stratified( struct unur_gen *gen, int *K, int n )
+     /*----------------------------------------------------------------------*/
+     /* fill array K with stratified sample of size n                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   K   ... pointer to array of (at least) length n                    */
+     /*   n   ... number of random variates                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,K,UNUR_ERR_NULL);
+
+  return _unur_sample_vr(gen,NULL,K,n,UNUR_SAMPLE_VR_STRATIFIED);
+} /* end of unur_sample_discr_stratified() */
+
+/*---------------------------------------------------------------------------*/
+
+/* state of auxiliary URNG used for variance reduction */
+struct unur_sample_vr_state {
+  UNUR_URNG *urng;       /* uniform random number generator of generator   */
+  double u;              /* stored uniform random number                   */
+  int replay;            /* whether u is returned by the next call         */
+};
+
+static double
+_unur_sample_vr_unif( void *state )
+     /*----------------------------------------------------------------------*/
+     /* sampling routine for auxiliary URNG:                                 */
+     /* returns the stored number u (once) if 'replay' is set.               */
+     /* otherwise a uniform random number is drawn and stored in u.          */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   state ... pointer to state of auxiliary URNG                       */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   uniform random number                                              */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_sample_vr_state *vr = state;
+
+  if (vr->replay) {
+    vr->replay = FALSE;
+    return vr->u;
+  }
+  return (vr->u = _unur_call_urng(vr->urng));
+} /* end of _unur_sample_vr_unif() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_sample_vr( struct unur_gen *gen, double *X, int *K, int n, int variant )
+     /*----------------------------------------------------------------------*/
+     /* fill array X (or K, resp.) with n random variates using the given    */
+     /* variance reduction technique.                                        */
+     /*                                                                      */
+     /* The uniform random numbers used by the inversion method are          */
+     /* controlled by means of an auxiliary URNG object that temporarily     */
+     /* replaces the URNG of the generator object. Thus truncated domains    */
+     /* are handled by the sampling routines of the methods.                 */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen     ... pointer to generator object                            */
+     /*   X       ... pointer to array for continuous variates (or NULL)     */
+     /*   K       ... pointer to array for discrete variates (or NULL)       */
+     /*   n       ... number of random variates                              */
+     /*   variant ... variance reduction technique                           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng vr_urng;           /* auxiliary URNG                      */
+  struct unur_sample_vr_state vr;     /* state of auxiliary URNG             */
+  UNUR_URNG *urng = gen->urng;        /* URNG of generator object            */
+  double V, x;
+  int i, j, k;
+
+  /* check type of generator object */
+  if ( (gen->method & UNUR_MASK_TYPE) != ((X) ? UNUR_METH_CONT : UNUR_METH_DISCR) ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  if (! unur_gen_is_inversion(gen)) {
+    _unur_error(gen->genid,UNUR_ERR_NO_QUANTILE,"inversion method required");
+    return UNUR_ERR_NO_QUANTILE;
+  }
+  if (n <= 0) return UNUR_SUCCESS;
+
+  /* make auxiliary URNG */
+  vr_urng = *urng;
+  vr_urng.sampleunif = _unur_sample_vr_unif;
+  vr_urng.state = &vr;
+  vr.urng = urng;
+  vr.u = 0.5;
+  vr.replay = FALSE;
+  gen->urng = &vr_urng;
+
+  /* run sampling routine */
+# define sample_vr(i) \
+  do { if (X) X[i] = gen->sample.cont(gen); else K[i] = gen->sample.discr(gen); } while(0)
+
+  switch (variant) {
+  case UNUR_SAMPLE_VR_ANTITHETIC:
+    for (i=0; i<n; i++) {
+      if (i%2) {
+	/* second variate of pair */
+	vr.u = 1. - vr.u;
+	vr.replay = TRUE;
+      }
+      sample_vr(i);
+    }
+    break;
+
+  case UNUR_SAMPLE_VR_STRATIFIED:
+    /* one point in each stratum [i/n,(i+1)/n) */
+    for (i=0; i<n; i++) {
+      V = _unur_call_urng(urng);
+      vr.u = (i + V) / n;
+      vr.replay = TRUE;
+      sample_vr(i);
+    }
+    /* random permutation (Fisher-Yates) */
+    for (i=n-1; i>0; i--) {
+      j = (int) (_unur_call_urng(urng) * (i+1));
+      if (j > i) j = i;
+      if (X) { x = X[i]; X[i] = X[j]; X[j] = x; }
+      else   { k = K[i]; K[i] = K[j]; K[j] = k; }
+    }
+    break;
+
+  default:
+    _unur_error(gen->genid,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
+    gen->urng = urng;
+    return UNUR_ERR_SHOULD_NOT_HAPPEN;
+  }
+
+# undef sample_vr
+
+  /* restore URNG */
+  gen->urng = urng;
+
+  if (X)
+    return (gen->sample.cont == _unur_sample_cont_error) ? UNUR_ERR_GEN_CONDITION : UNUR_SUCCESS;
+  else
+    return (gen->sample.discr == _unur_sample_discr_error) ? UNUR_ERR_GEN_CONDITION : UNUR_SUCCESS;
+
+} /* end of _unur_sample_vr() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_gen_remove_pdfcache( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* remove cache for PDF values from distribution objects of generator   */
+     /* and its auxiliary generators.                                        */
+     /* The cache is only used during setup. It must not be used by the      */
+     /* sampling routines as it is not thread-safe.                          */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_distr *distr;
+  int i;
+
+  for (distr = gen->distr; distr != NULL && distr->type == UNUR_DISTR_CONT; distr = distr->base)
+    if (distr->data.cont.pdfcache)
+      unur_distr_cont_set_pdfcache(distr,0);
+
+  /* auxiliary generators */
+  if (gen->gen_aux)
+    _unur_gen_remove_pdfcache(gen->gen_aux);
+  for (i=0; i<gen->n_gen_aux_list; i++)
+    if (gen->gen_aux_list[i])
+      _unur_gen_remove_pdfcache(gen->gen_aux_list[i]);
+
+} /* end of _unur_gen_remove_pdfcache() */
+
+/*---------------------------------------------------------------------------*/
+/* Point processes with given hazard rate                                    */
+
+int
+unur_sample_hr_process( struct unur_gen *gen, double T, int renewal,
+			double *times, int size, int *n_events )
+     /*----------------------------------------------------------------------*/
+     /* generate all event times in [0,T] of point process with given       */
+     /* hazard rate.                                                         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen      ... pointer to generator object                           */
+     /*   T        ... end of time interval                                  */
+     /*   renewal  ... TRUE for renewal process, FALSE for NHPP              */
+     /*   times    ... pointer to array of (at least) length size            */
+     /*   size     ... length of array times                                 */
+     /*   n_events ... pointer for storing number of events                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  return unur_sample_hr_process_array(gen,T,renewal,times,size,n_events,1);
+} /* end of unur_sample_hr_process() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_sample_hr_process_array( struct unur_gen *gen, double T, int renewal,
+			      double *times, int size, int *n_events, int n_comp )
+     /*----------------------------------------------------------------------*/
+     /* generate all event times in [0,T] of point processes with given      */
+     /* hazard rate for n_comp independent components.                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen      ... pointer to generator object                           */
+     /*   T        ... end of time interval                                  */
+     /*   renewal  ... TRUE for renewal process, FALSE for NHPP              */
+     /*   times    ... pointer to array of (at least) length n_comp*size     */
+     /*   size     ... maximal number of events for each component           */
+     /*   n_events ... pointer to array of length n_comp for storing number  */
+     /*                of events                                             */
+     /*   n_comp   ... number of components                                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int truncated = FALSE;
+  int rcode;
+  int c;
+
+  /* check arguments */
+  _unur_check_NULL("sample",gen,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,times,UNUR_ERR_NULL);
+  _unur_check_NULL(gen->genid,n_events,UNUR_ERR_NULL);
+  if ( (gen->method & UNUR_MASK_TYPE) != UNUR_METH_CONT ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  if (size < 0) {
+    _unur_error(gen->genid,UNUR_ERR_GENERIC,"size < 0");
+    return UNUR_ERR_GENERIC;
+  }
+  if (n_comp < 1) {
+    _unur_error(gen->genid,UNUR_ERR_GENERIC,"n_comp < 1");
+    return UNUR_ERR_GENERIC;
+  }
+  if (!renewal && gen->sample_nhpp == NULL) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"method HRB, HRD, or HRI required");
+    for (c=0; c<n_comp; c++) n_events[c] = 0;
+    return UNUR_ERR_GEN_INVALID;
+  }
+  if (gen->sample.cont == _unur_sample_cont_error) {
+    /* sampling disabled (e.g., by failed unur_reinit() call) */
+    for (c=0; c<n_comp; c++) n_events[c] = 0;
+    return UNUR_ERR_GEN_CONDITION;
+  }
+
+  /* the components are processed one after the other */
+  for (c=0; c<n_comp; c++) {
+    rcode = (renewal)
+      ? _unur_sample_hr_renewal(gen,T,times+c*size,size,n_events+c)
+      : gen->sample_nhpp(gen,T,times+c*size,size,n_events+c);
+
+    if (rcode == UNUR_ERR_GEN_SAMPLING)
+      truncated = TRUE;
+    else if (rcode != UNUR_SUCCESS)
+      return rcode;
+  }
+
+  if (truncated) {
+    _unur_warning(gen->genid,UNUR_ERR_GEN_SAMPLING,"array too small: event times truncated");
+    return UNUR_ERR_GEN_SAMPLING;
+  }
+
+  return UNUR_SUCCESS;
+} /* end of unur_sample_hr_process_array() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_hr_spacings_reset( struct unur_hr_spacings *sp )
+     /*----------------------------------------------------------------------*/
+     /* discard all spacings in block                                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sp  ... pointer to block of spacings                               */
+     /*----------------------------------------------------------------------*/
+{
+  sp->next = UNUR_HR_SPACINGS_BLOCK;
+  sp->gen = NULL;
+  sp->urng = NULL;
+} /* end of _unur_hr_spacings_reset() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_hr_spacings_fill( struct unur_gen *gen, struct unur_hr_spacings *sp )
+     /*----------------------------------------------------------------------*/
+     /* make sure that the block contains unused standard exponential        */
+     /* spacings. A new block is drawn if all spacings have been used.       */
+     /* Unused spacings are kept for the next call to the sampling routine   */
+     /* of the point process. They are discarded when they have been drawn   */
+     /* by another generator object (i.e., the data of the generator object  */
+     /* have been copied into a clone or a sampling context) or by another   */
+     /* URNG.                                                                */
+     /*                                                                      */
+     /* The unused spacings are sp->E[sp->next], ...,                        */
+     /* sp->E[UNUR_HR_SPACINGS_BLOCK-1]. The caller must increment sp->next  */
+     /* by the number of spacings that it has used.                          */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   sp  ... pointer to block of spacings                               */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   number of unused spacings (at least 1)                             */
+     /*----------------------------------------------------------------------*/
+{
+  double U;
+  int i;
+
+  if (sp->gen != gen || sp->urng != gen->urng)
+    /* spacings have been drawn for another generator object or URNG */
+    sp->next = UNUR_HR_SPACINGS_BLOCK;
+
+  if (sp->next >= UNUR_HR_SPACINGS_BLOCK) {
+    /* draw new block */
+    for (i=0; i<UNUR_HR_SPACINGS_BLOCK; i++) {
+      while ( _unur_iszero(U = 1.-_unur_call_urng(gen->urng)) );
+      sp->E[i] = -log(U);
+    }
+    sp->next = 0;
+    sp->gen = gen;
+    sp->urng = gen->urng;
+  }
+
+  return (UNUR_HR_SPACINGS_BLOCK - sp->next);
+} /* end of _unur_hr_spacings_fill() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_hr_spacings_next( struct unur_gen *gen, struct unur_hr_spacings *sp )
+     /*----------------------------------------------------------------------*/
+     /* get next standard exponential spacing from block                     */
+     /* (see _unur_hr_spacings_fill())                                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*   sp  ... pointer to block of spacings                               */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   standard exponential random variate                                */
+     /*----------------------------------------------------------------------*/
+{
+  _unur_hr_spacings_fill(gen,sp);
+  return sp->E[sp->next++];
+} /* end of _unur_hr_spacings_next() */
+
+/*---------------------------------------------------------------------------*/
+
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_sample_hr_renewal( struct unur_gen *gen, double T, double *times, int size, int *n_events )
+     /*----------------------------------------------------------------------*/
+     /* generate renewal process: the event times are the partial sums of    */
+     /* random variates that are generated one at a time.                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen      ... pointer to generator object                           */
+     /*   T        ... end of time interval                                  */
+     /*   times    ... pointer to array of (at least) length size            */
+     /*   size     ... length of array times                                 */
+     /*   n_events ... pointer for storing number of events                  */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   UNUR_ERR_GEN_SAMPLING ... if array times is too small              */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  double X;                       /* inter-event time                        */
+  double t = 0.;
+  int n = 0;                      /* number of events                        */
+
+  *n_events = 0;
+
+  while (1) {
+    X = _unur_sample_cont(gen);
+    if (gen->sample.cont == _unur_sample_cont_error)
+      return UNUR_ERR_GEN_CONDITION;
+    if (X < 0.) {
+      _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"negative inter-event time");
+      return UNUR_ERR_GEN_CONDITION;
+    }
+    t += X;
+    if (t > T)
+      return UNUR_SUCCESS;
+    if (n >= size)
+      return UNUR_ERR_GEN_SAMPLING;
+    times[n] = t;
+    *n_events = ++n;
+  }
+
+} /* end of _unur_sample_hr_renewal() */
+
+/*---------------------------------------------------------------------------*/
+/* Estimate quantiles                                                        */
+
+double
+unur_quantile ( struct unur_gen *gen, double U )
+{
+  /* check arguments */
+  CHECK_NULL(gen,FALSE);
+
+  /* Remark:
+   * We DO NOT check the argument U here 
+   * (i.e. whether 0<=U<=1 holds)
+   */
+  switch (gen->method) {
+  case UNUR_METH_HINV:
+    return unur_hinv_eval_approxinvcdf(gen,U);
+
+  case UNUR_METH_NINV:
+    return unur_ninv_eval_approxinvcdf(gen,U);
+
+  case UNUR_METH_PINV:
+    return unur_pinv_eval_approxinvcdf(gen,U);
+
+  case UNUR_METH_CSTD:
+    if (((struct unur_cstd_gen*)gen->datap)->is_inversion)
+      return unur_cstd_eval_invcdf(gen,U);
+    break;
+
+  case UNUR_METH_MIXT:
+    if (((struct unur_mixt_gen*)gen->datap)->is_inversion)
+      return unur_mixt_eval_invcdf(gen,U);
+    break;
+
+  case UNUR_METH_DGT:
+    return ((double) unur_dgt_eval_invcdf(gen,U));
+
+  case UNUR_METH_DSTD:
+    if (((struct unur_dstd_gen*)gen->datap)->is_inversion)
+      return unur_dstd_eval_invcdf(gen,U);
+    break;
+  }
+  
+  /* default: */
+  _unur_error(gen->genid,UNUR_ERR_NO_QUANTILE,"");
+  return UNUR_INFINITY;
+
+} /* end of unur_quantile() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_gen_is_inversion ( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* check for type of generator object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  if (gen==NULL) return FALSE;
+
+  switch (gen->method) {
+  case UNUR_METH_HINV:
+  case UNUR_METH_NINV:
+  case UNUR_METH_PINV:
+  case UNUR_METH_DGT:
+    return TRUE;
+
+  case UNUR_METH_CSTD:
+    return (((struct unur_cstd_gen*)gen->datap)->is_inversion);
+
+  case UNUR_METH_MIXT:
+    return (((struct unur_mixt_gen*)gen->datap)->is_inversion);
+
+  default:
+    return FALSE;
+  }
+} /* end of unur_gen_is_inversion() */
+
+/*---------------------------------------------------------------------------*/
+/* aux routines when no sampling routine is available                         */
+
+int
+_unur_sample_discr_error( struct unur_gen *gen ATTRIBUTE__UNUSED )
+{
+  unur_errno = UNUR_ERR_GEN_CONDITION;
+  return 0;
+} /* end of _unur_sample_discr_error() */
+
+double
+_unur_sample_cont_error( struct unur_gen *gen ATTRIBUTE__UNUSED )
+{
+  unur_errno = UNUR_ERR_GEN_CONDITION;
+  return UNUR_INFINITY;
+} /* end of _unur_sample_cont_error() */
+
+int
+_unur_sample_cvec_error( struct unur_gen *gen, double *vec )
+{ 
+  int d;
+  unur_errno = UNUR_ERR_GEN_CONDITION;
+  for (d=0; d<(gen->distr->dim); d++) vec[d] = UNUR_INFINITY;
+  return UNUR_FAILURE;
+} /* end of _unur_sample_cvec_error() */
+
+int
+_unur_sample_matr_error( struct unur_gen *gen, double *mat )
+{ 
+  int n_rows, n_cols, dim, j;
+  
+  unur_errno = UNUR_ERR_GEN_CONDITION;
+  unur_distr_matr_get_dim(gen->distr, &n_rows, &n_cols );
+  dim = n_rows * n_cols;
+  for (j=0; j<dim; j++)
+    mat[j] = UNUR_INFINITY;
+  return UNUR_FAILURE;
+} /* end of _unur_sample_matr_error() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+unur_free( struct unur_gen *gen )
+{                
+  if (gen == NULL) return;
+
+  /* generator object is still used by sampling contexts: */
+  /* it is destroyed together with the last context.      */
+  if (gen->n_contexts > 0) {
+    gen->free_pending = TRUE;
+    return;
+  }
+
+  gen->destroy(gen);
+} /* end of unur_free() */
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************/
+/**                                                                         **/
+/**  Sampling contexts                                                      **/
+/**                                                                         **/
+/*****************************************************************************/
+
+struct unur_gen *
+unur_gen_share( struct unur_gen *gen, UNUR_URNG *urng )
+     /*----------------------------------------------------------------------*/
+     /* create a sampling context for generator object.                      */
+     /* the context shares all tables with 'gen' but has its own URNG and    */
+     /* its own copy of the (small) mutable parts of the generator object.   */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen  ... pointer to generator object                               */
+     /*   urng ... pointer to uniform random number generator for context    */
+     /*            (if NULL, the URNG of 'gen' is used)                      */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to sampling context                                        */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return NULL                                                        */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_gen *core;
+
+  /* check arguments */
+  _unur_check_NULL( "share", gen, NULL );
+
+  /* all contexts share the same generator object */
+  core = (gen->core) ? gen->core : gen;
+
+  /* check method and stop adaptive steps */
+  if (_unur_gen_share_prepare(core) != UNUR_SUCCESS)
+    return NULL;
+
+  return _unur_gen_share_make(core, (urng) ? urng : gen->urng);
+} /* end of unur_gen_share() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_gen_is_shared( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* check whether generator object is a sampling context                 */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  if (gen==NULL) return FALSE;
+
+  return (gen->core != NULL) ? TRUE : FALSE;
+} /* end of unur_gen_is_shared() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_gen_share_prepare( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* check whether generator object can be shared and stop adaptive       */
+     /* steps, i.e., the tables of the generator object are not changed      */
+     /* during sampling any more.                                            */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  switch (gen->method) {
+  case UNUR_METH_AROU:
+    ((struct unur_arou_gen*)gen->datap)->max_segs = ((struct unur_arou_gen*)gen->datap)->n_segs;
+    break;
+  case UNUR_METH_ARS:
+    ((struct unur_ars_gen*)gen->datap)->max_ivs = ((struct unur_ars_gen*)gen->datap)->n_ivs;
+    break;
+  case UNUR_METH_TABL:
+    ((struct unur_tabl_gen*)gen->datap)->max_ivs = ((struct unur_tabl_gen*)gen->datap)->n_ivs;
+    break;
+  case UNUR_METH_TDR:
+    ((struct unur_tdr_gen*)gen->datap)->max_ivs = ((struct unur_tdr_gen*)gen->datap)->n_ivs;
+    break;
+
+  case UNUR_METH_DARI:
+    if (!((struct unur_dari_gen*)gen->datap)->eager) {
+      /* table must be computed before sampling */
+      ((struct unur_dari_gen*)gen->datap)->eager = TRUE;
+      if (gen->reinit(gen) != UNUR_SUCCESS)
+	return UNUR_ERR_GEN_INVALID;
+    }
+    break;
+
+  case UNUR_METH_DGT:
+    if (((struct unur_dgt_gen*)gen->datap)->cumblocks != NULL) {
+      /* lazy variant: tables are computed during sampling */
+      _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"sampling contexts not supported for lazy tables");
+      return UNUR_ERR_GEN_INVALID;
+    }
+    break;
+
+  case UNUR_METH_CSTD:
+  case UNUR_METH_DAU:
+  case UNUR_METH_DSTD:
+  case UNUR_METH_HINV:
+  case UNUR_METH_HRB:
+  case UNUR_METH_HRD:
+  case UNUR_METH_HRI:
+  case UNUR_METH_MIXT:
+  case UNUR_METH_NINV:
+  case UNUR_METH_PINV:
+    /* tables are not changed during sampling */
+    break;
+
+  default:
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"sampling contexts not supported");
+    return UNUR_ERR_GEN_INVALID;
+  }
+
+  /* auxiliary generators */
+  if (gen->gen_aux)
+    if (_unur_gen_share_prepare(gen->gen_aux) != UNUR_SUCCESS)
+      return UNUR_ERR_GEN_INVALID;
+  for (i=0; i<gen->n_gen_aux_list; i++)
+    if (gen->gen_aux_list[i])
+      if (_unur_gen_share_prepare(gen->gen_aux_list[i]) != UNUR_SUCCESS)
+	return UNUR_ERR_GEN_INVALID;
+
+  return UNUR_SUCCESS;
+} /* end of _unur_gen_share_prepare() */
+
+/*---------------------------------------------------------------------------*/
+
+struct unur_gen *
+_unur_gen_share_make( struct unur_gen *core, UNUR_URNG *urng )
+     /*----------------------------------------------------------------------*/
+     /* create sampling context for generator object                         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   core ... pointer to (shared) generator object                      */
+     /*   urng ... pointer to uniform random number generator for context    */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to sampling context                                        */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_gen *ctx;
+  int i;
+
+  /* copy main part and data structure.                       */
+  /* all pointers in the data structure point into the tables */
+  /* of the shared generator object.                          */
+  ctx = _unur_xmalloc( sizeof(struct unur_gen) );
+  memcpy( ctx, core, sizeof(struct unur_gen) );
+  ctx->datap = _unur_xmalloc(core->s_datap);
+  memcpy (ctx->datap, core->datap, core->s_datap);
+
+  /* set generator identifier */
+  ctx->genid = _unur_set_genid(core->genid);
+
+#ifdef UNUR_ENABLE_INFO
+  /* do not copy pointer to info string */
+  ctx->infostr = NULL;
+#endif
+
+  /* distribution object is shared */
+  ctx->distr_is_privatecopy = FALSE;
+
+  /* each sampling context has its own counters */
+  _unur_stats_reset(ctx);
+
+  /* uniform random number generators */
+  ctx->urng = urng;
+  ctx->urng_aux = (core->urng_aux) ? urng : NULL;
+
+  /* mutable parts of data structure */
+  switch (core->method) {
+  case UNUR_METH_CSTD:
+#define GEN ((struct unur_cstd_gen*)ctx->datap)
+    if (GEN->gen_param) {
+      GEN->gen_param = _unur_xmalloc(GEN->n_gen_param * sizeof(double));
+      memcpy(GEN->gen_param, ((struct unur_cstd_gen*)core->datap)->gen_param,
+	     GEN->n_gen_param * sizeof(double));
+    }
+    GEN->flag = 1;   /* no stored random variate */
+#undef GEN
+    break;
+  case UNUR_METH_DSTD:
+#define GEN ((struct unur_dstd_gen*)ctx->datap)
+    if (GEN->gen_param) {
+      GEN->gen_param = _unur_xmalloc(GEN->n_gen_param * sizeof(double));
+      memcpy(GEN->gen_param, ((struct unur_dstd_gen*)core->datap)->gen_param,
+	     GEN->n_gen_param * sizeof(double));
+    }
+    if (GEN->gen_iparam) {
+      GEN->gen_iparam = _unur_xmalloc(GEN->n_gen_iparam * sizeof(int));
+      memcpy(GEN->gen_iparam, ((struct unur_dstd_gen*)core->datap)->gen_iparam,
+	     GEN->n_gen_iparam * sizeof(int));
+    }
+#undef GEN
+    break;
+  default:
+    /* tables belong to the shared generator object */
+    ctx->memsize = NULL;
+    break;
+  }
+
+  /* auxiliary generators */
+  if (core->gen_aux)
+    ctx->gen_aux = _unur_gen_share_make(core->gen_aux, urng);
+  if (core->gen_aux_list && core->n_gen_aux_list) {
+    ctx->gen_aux_list = _unur_xmalloc( core->n_gen_aux_list * sizeof(struct unur_gen *) );
+    /* all entries may point to the same generator object */
+    /* (see _unur_gen_list_clone())                        */
+    if (core->n_gen_aux_list > 1 && core->gen_aux_list[0] == core->gen_aux_list[1]) {
+      ctx->gen_aux_list[0] = _unur_gen_share_make(core->gen_aux_list[0], urng);
+      for (i=1; i<core->n_gen_aux_list; i++)
+	ctx->gen_aux_list[i] = ctx->gen_aux_list[0];
+    }
+    else {
+      for (i=0; i<core->n_gen_aux_list; i++)
+	ctx->gen_aux_list[i] = (core->gen_aux_list[i])
+	  ? _unur_gen_share_make(core->gen_aux_list[i], urng) : NULL;
+    }
+  }
+
+  /* routines for destroying and cloning context */
+  ctx->destroy = _unur_gen_share_free;
+  ctx->clone = _unur_gen_share_clone;
+  ctx->reinit = NULL;    /* shared tables cannot be changed */
+
+  /* link to shared generator object */
+  ctx->core = core;
+  ctx->n_contexts = 0;
+  ctx->free_pending = FALSE;
+  ++(core->n_contexts);
+
+  return ctx;
+} /* end of _unur_gen_share_make() */
+
+/*---------------------------------------------------------------------------*/
+
+struct unur_gen *
+_unur_gen_share_clone( const struct unur_gen *ctx )
+     /*----------------------------------------------------------------------*/
+     /* clone sampling context, i.e., create new context for the same        */
+     /* shared generator object                                              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ctx ... pointer to sampling context                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to new sampling context                                    */
+     /*----------------------------------------------------------------------*/
+{
+  return _unur_gen_share_make(ctx->core, ctx->urng);
+} /* end of _unur_gen_share_clone() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_gen_share_free( struct unur_gen *ctx )
+     /*----------------------------------------------------------------------*/
+     /* destroy sampling context.                                            */
+     /* the shared generator object is destroyed when it is not used by      */
+     /* other contexts and unur_free() has already been called.              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ctx ... pointer to sampling context                                */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_gen *core = ctx->core;
+
+  /* auxiliary generators */
+  if (ctx->gen_aux)
+    _unur_free(ctx->gen_aux);
+  if (ctx->gen_aux_list && ctx->n_gen_aux_list)
+    _unur_gen_list_free( ctx->gen_aux_list, ctx->n_gen_aux_list );
+
+  /* mutable parts of data structure */
+  switch (ctx->method) {
+  case UNUR_METH_CSTD:
+    if (((struct unur_cstd_gen*)ctx->datap)->gen_param)
+      free(((struct unur_cstd_gen*)ctx->datap)->gen_param);
+    break;
+  case UNUR_METH_DSTD:
+    if (((struct unur_dstd_gen*)ctx->datap)->gen_param)
+      free(((struct unur_dstd_gen*)ctx->datap)->gen_param);
+    if (((struct unur_dstd_gen*)ctx->datap)->gen_iparam)
+      free(((struct unur_dstd_gen*)ctx->datap)->gen_iparam);
+    break;
+  default:
+    break;
+  }
+
+  _unur_free_genid(ctx);
+  free(ctx->datap);
+#ifdef UNUR_ENABLE_INFO
+  if (ctx->infostr) _unur_string_free(ctx->infostr);
+#endif
+  free(ctx);
+
+  /* release shared generator object */
+  --(core->n_contexts);
+  if (core->n_contexts == 0 && core->free_pending) {
+    core->free_pending = FALSE;
+    core->destroy(core);
+  }
+} /* end of _unur_gen_share_free() */
+
+/*---------------------------------------------------------------------------*/
+
+/*****************************************************************************/
+/**                                                                         **/
+/**  Pools of generator objects                                             **/
+/**                                                                         **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Flags for slots in pool.                                                  */
+/* We use the atomic builtins of GCC (>= 4.7) and clang when available.      */
+/* Otherwise acquiring and releasing generator objects is not thread-safe.   */
+
+#ifdef __ATOMIC_ACQUIRE
+#  define _unur_pool_trylock(flag)  ( __atomic_exchange_n((flag), 1, __ATOMIC_ACQUIRE) == 0 )
+#  define _unur_pool_unlock(flag)   __atomic_store_n((flag), 0, __ATOMIC_RELEASE)
+#  define _unur_pool_is_locked(flag) ( __atomic_load_n((flag), __ATOMIC_RELAXED) != 0 )
+#  define _unur_pool_next(pool)     __atomic_fetch_add(&((pool)->next), 1u, __ATOMIC_RELAXED)
+#else
+#  define _unur_pool_trylock(flag)  ( (*(flag)) ? FALSE : ((*(flag) = 1), TRUE) )
+#  define _unur_pool_unlock(flag)   do { *(flag) = 0; } while(0)
+#  define _unur_pool_is_locked(flag) ( *(flag) != 0 )
+#  define _unur_pool_next(pool)     ((pool)->next)++
+#endif
+
+/*---------------------------------------------------------------------------*/
+
+struct unur_gen_pool *
+unur_gen_pool_new( const struct unur_gen *proto, int n )
+     /*----------------------------------------------------------------------*/
+     /* create pool of 'n' generator objects. each object is a clone of      */
+     /* the prototype 'proto'.                                               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   proto ... pointer to prototype generator object                    */
+     /*   n     ... number of generator objects in pool                      */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to pool                                                    */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return NULL                                                        */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_gen_pool *pool;
+  int i;
 
-int
-unur_sample_vec( struct unur_gen *gen, double *vector )
-{
-  CHECK_NULL(gen,UNUR_ERR_NULL);
-  return (gen->sample.cvec(gen,vector));
-} /* end of unur_sample_vec() */
+  /* check arguments */
+  _unur_check_NULL( "pool", proto, NULL );
+  if (n < 1) {
+    _unur_error("pool",UNUR_ERR_PAR_SET,"size of pool < 1");
+    return NULL;
+  }
 
-int
-unur_sample_matr( struct unur_gen *gen, double *matrix )
-{
-  CHECK_NULL(gen,UNUR_ERR_NULL);
-  return (gen->sample.matr(gen,matrix));
-} /* end of unur_sample_matr() */
+  /* allocate pool */
+  pool = _unur_xmalloc( sizeof(struct unur_gen_pool) );
+  COOKIE_SET(pool,CK_GEN_POOL);
+  pool->gen = _unur_xmalloc( n * sizeof(struct unur_gen *) );
+  pool->in_use = _unur_xmalloc( n * sizeof(int) );
+  pool->n_gen = n;
+  pool->next = 0u;
+  pool->urng = proto->urng;
+  pool->urng_aux = proto->urng_aux;
+
+  /* clone prototype */
+  for (i=0; i<n; i++) {
+    pool->in_use[i] = 0;
+    pool->gen[i] = _unur_gen_clone(proto);
+    if (pool->gen[i] == NULL) {
+      pool->n_gen = i;
+      unur_gen_pool_free(pool);
+      return NULL;
+    }
+  }
+
+  return pool;
+} /* end of unur_gen_pool_new() */
 
 /*---------------------------------------------------------------------------*/
-/* Estimate quantiles                                                        */
 
-double
-unur_quantile ( struct unur_gen *gen, double U )
+struct unur_gen *
+unur_gen_pool_acquire( struct unur_gen_pool *pool )
+     /*----------------------------------------------------------------------*/
+     /* get a generator object from pool that is not in use                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   pool ... pointer to pool                                           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to generator object                                        */
+     /*   NULL if all generator objects are in use                           */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return NULL                                                        */
+     /*----------------------------------------------------------------------*/
 {
+  int i, j;
+
   /* check arguments */
-  CHECK_NULL(gen,FALSE);
+  _unur_check_NULL( "pool", pool, NULL );
+  COOKIE_CHECK(pool,CK_GEN_POOL,NULL);
 
-  /* Remark:
-   * We DO NOT check the argument U here 
-   * (i.e. whether 0<=U<=1 holds)
-   */
-  switch (gen->method) {
-  case UNUR_METH_HINV:
-    return unur_hinv_eval_approxinvcdf(gen,U);
+  /* start search at different slots to reduce contention */
+  j = (int) (_unur_pool_next(pool) % (unsigned) pool->n_gen);
 
-  case UNUR_METH_NINV:
-    return unur_ninv_eval_approxinvcdf(gen,U);
+  for (i=0; i<pool->n_gen; i++) {
+    if (!_unur_pool_is_locked(pool->in_use+j) && _unur_pool_trylock(pool->in_use+j))
+      return pool->gen[j];
+    if (++j == pool->n_gen) j = 0;
+  }
 
-  case UNUR_METH_PINV:
-    return unur_pinv_eval_approxinvcdf(gen,U);
+  /* all generator objects are in use */
+  return NULL;
+} /* end of unur_gen_pool_acquire() */
 
-  case UNUR_METH_CSTD:
-    if (((struct unur_cstd_gen*)gen->datap)->is_inversion)
-      return unur_cstd_eval_invcdf(gen,U);
-    break;
+/*---------------------------------------------------------------------------*/
 
-  case UNUR_METH_MIXT:
-    if (((struct unur_mixt_gen*)gen->datap)->is_inversion)
-      return unur_mixt_eval_invcdf(gen,U);
-    break;
+struct unur_gen *
+unur_gen_pool_acquire_urng( struct unur_gen_pool *pool, UNUR_URNG *urng )
+     /*----------------------------------------------------------------------*/
+     /* get a generator object from pool that is not in use and set its      */
+     /* (auxiliary) URNG                                                     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   pool ... pointer to pool                                           */
+     /*   urng ... pointer to uniform random number generator                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   pointer to generator object                                        */
+     /*   NULL if all generator objects are in use                           */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return NULL                                                        */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_gen *gen;
 
-  case UNUR_METH_DGT:
-    return ((double) unur_dgt_eval_invcdf(gen,U));
+  /* check arguments */
+  _unur_check_NULL( "pool", pool, NULL );
+  _unur_check_NULL( "pool", urng, NULL );
 
-  case UNUR_METH_DSTD:
-    if (((struct unur_dstd_gen*)gen->datap)->is_inversion)
-      return unur_dstd_eval_invcdf(gen,U);
-    break;
-  }
-  
-  /* default: */
-  _unur_error(gen->genid,UNUR_ERR_NO_QUANTILE,"");
-  return UNUR_INFINITY;
+  gen = unur_gen_pool_acquire(pool);
+  if (gen == NULL) return NULL;
 
-} /* end of unur_quantile() */
+  /* the generator object has been acquired exclusively: */
+  /* thus we can safely replace its URNGs.                */
+  unur_chg_urng(gen, urng);
+
+  return gen;
+} /* end of unur_gen_pool_acquire_urng() */
 
 /*---------------------------------------------------------------------------*/
 
 int
-unur_gen_is_inversion ( const struct unur_gen *gen )
+unur_gen_pool_release( struct unur_gen_pool *pool, struct unur_gen *gen )
      /*----------------------------------------------------------------------*/
-     /* check for type of generator object                                   */
+     /* reset generator object and return it to pool                         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   pool ... pointer to pool                                           */
+     /*   gen  ... pointer to generator object acquired from pool            */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
      /*----------------------------------------------------------------------*/
 {
+  int i;
+
   /* check arguments */
-  if (gen==NULL) return FALSE;
+  _unur_check_NULL( "pool", pool, UNUR_ERR_NULL );
+  COOKIE_CHECK(pool,CK_GEN_POOL,UNUR_ERR_COOKIE);
+  _unur_check_NULL( "pool", gen, UNUR_ERR_NULL );
 
-  switch (gen->method) {
-  case UNUR_METH_HINV:
-  case UNUR_METH_NINV:
-  case UNUR_METH_PINV:
-  case UNUR_METH_DGT:
-    return TRUE;
+  /* find slot */
+  for (i=0; i<pool->n_gen; i++)
+    if (pool->gen[i] == gen) break;
 
-  case UNUR_METH_CSTD:
-    return (((struct unur_cstd_gen*)gen->datap)->is_inversion);
+  if (i == pool->n_gen || !_unur_pool_is_locked(pool->in_use+i)) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"generator object not acquired from pool");
+    return UNUR_ERR_GEN_INVALID;
+  }
 
-  case UNUR_METH_MIXT:
-    return (((struct unur_mixt_gen*)gen->datap)->is_inversion);
+  /* restore URNGs of prototype */
+  if (pool->urng)
+    unur_chg_urng(gen, pool->urng);
+  if (pool->urng_aux && pool->urng_aux != pool->urng)
+    unur_chg_urng_aux(gen, pool->urng_aux);
 
-  default:
-    return FALSE;
-  }
-} /* end of unur_gen_is_inversion() */
+  /* reset mutable state */
+  _unur_gen_pool_reset(gen);
+
+  _unur_pool_unlock(pool->in_use+i);
+
+  return UNUR_SUCCESS;
+} /* end of unur_gen_pool_release() */
 
 /*---------------------------------------------------------------------------*/
-/* aux routines when no sampling routine is available                         */
 
-int
-_unur_sample_discr_error( struct unur_gen *gen ATTRIBUTE__UNUSED )
+void
+unur_gen_pool_free( struct unur_gen_pool *pool )
+     /*----------------------------------------------------------------------*/
+     /* destroy pool and all its generator objects                           */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   pool ... pointer to pool                                           */
+     /*----------------------------------------------------------------------*/
 {
-  unur_errno = UNUR_ERR_GEN_CONDITION;
-  return 0;
-} /* end of _unur_sample_discr_error() */
+  int i;
 
-double
-_unur_sample_cont_error( struct unur_gen *gen ATTRIBUTE__UNUSED )
-{
-  unur_errno = UNUR_ERR_GEN_CONDITION;
-  return UNUR_INFINITY;
-} /* end of _unur_sample_cont_error() */
+  if (pool == NULL) return;
+  COOKIE_CHECK(pool,CK_GEN_POOL,RETURN_VOID);
 
-int
-_unur_sample_cvec_error( struct unur_gen *gen, double *vec )
-{ 
-  int d;
-  unur_errno = UNUR_ERR_GEN_CONDITION;
-  for (d=0; d<(gen->distr->dim); d++) vec[d] = UNUR_INFINITY;
-  return UNUR_FAILURE;
-} /* end of _unur_sample_cvec_error() */
+  for (i=0; i<pool->n_gen; i++)
+    unur_free(pool->gen[i]);
 
-int
-_unur_sample_matr_error( struct unur_gen *gen, double *mat )
-{ 
-  int n_rows, n_cols, dim, j;
-  
-  unur_errno = UNUR_ERR_GEN_CONDITION;
-  unur_distr_matr_get_dim(gen->distr, &n_rows, &n_cols );
-  dim = n_rows * n_cols;
-  for (j=0; j<dim; j++)
-    mat[j] = UNUR_INFINITY;
-  return UNUR_FAILURE;
-} /* end of _unur_sample_matr_error() */
+  free(pool->gen);
+  free(pool->in_use);
+  free(pool);
+} /* end of unur_gen_pool_free() */
 
 /*---------------------------------------------------------------------------*/
 
 void
-unur_free( struct unur_gen *gen )
-{                
-  if (gen) gen->destroy(gen);
-} /* end of unur_free() */
+_unur_gen_pool_reset( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* reset the parts of a generator object that are changed during       */
+     /* sampling. tables that are improved by adaptive steps are kept.       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  /* counters */
+  _unur_stats_reset(gen);
+
+  switch (gen->method) {
+  case UNUR_METH_CSTD:
+    /* remove stored random variate */
+    ((struct unur_cstd_gen*)gen->datap)->flag = 1;
+    break;
+  case UNUR_METH_GIBBS:
+    unur_gibbs_reset_state(gen);
+    break;
+  case UNUR_METH_HITRO:
+    unur_hitro_reset_state(gen);
+    break;
+  default:
+    break;
+  }
+
+  /* auxiliary generators */
+  if (gen->gen_aux)
+    _unur_gen_pool_reset(gen->gen_aux);
+  for (i=0; i<gen->n_gen_aux_list; i++)
+    if (gen->gen_aux_list[i] &&
+	(i==0 || gen->gen_aux_list[i] != gen->gen_aux_list[0]))
+      _unur_gen_pool_reset(gen->gen_aux_list[i]);
+
+} /* end of _unur_gen_pool_reset() */
+
+/*---------------------------------------------------------------------------*/
+
+#undef _unur_pool_trylock
+#undef _unur_pool_unlock
+#undef _unur_pool_is_locked
+#undef _unur_pool_next
 
 /*---------------------------------------------------------------------------*/
 
@@ -301,6 +1498,9 @@ unur_gen_info( struct unur_gen *gen, int help )
     /* create info string */
     gen->info((struct unur_gen*) gen, help);
 
+    /* counters for sampling routine */
+    _unur_gen_info_stats(gen);
+
     /* return info string */
     return gen->infostr->text;
   }
@@ -313,6 +1513,168 @@ unur_gen_info( struct unur_gen *gen, int help )
 
 #endif
 } /* end of unur_gen_info() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_gen_info_stats( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* append counters of sampling routine to info string                   */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen  ... pointer to generator object                               */
+     /*----------------------------------------------------------------------*/
+{
+#if defined(UNUR_ENABLE_INFO) && defined(UNUR_ENABLE_STATS)
+  struct unur_string *info = gen->infostr;
+  double n = (double) gen->stats.sample;
+
+  /* nothing to do if no random variates have been generated */
+  if (gen->stats.sample == 0) return;
+
+  _unur_string_append(info,"observed sampling statistics:\n");
+  _unur_string_append(info,"   # random variates = %lu\n", gen->stats.sample);
+  if (gen->stats.trial > 0) {
+    _unur_string_append(info,"   # trials per variate = %g  [observed rejection constant]\n",
+			gen->stats.trial / n);
+    _unur_string_append(info,"   squeeze acceptance = %g\n",
+			gen->stats.squeeze / (double) gen->stats.trial);
+  }
+  _unur_string_append(info,"   # PDF evaluations per variate = %g\n", gen->stats.pdf / n);
+  if (gen->stats.search > 0)
+    _unur_string_append(info,"   # search steps per variate = %g\n", gen->stats.search / n);
+  _unur_string_append(info,"\n");
+#else
+  (void) gen;
+#endif
+} /* end of _unur_gen_info_stats() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_gen_get_stats( const struct unur_gen *gen, unsigned long *n_sample,
+		    unsigned long *n_trial, unsigned long *n_squeeze,
+		    unsigned long *n_pdf, unsigned long *n_search )
+     /*----------------------------------------------------------------------*/
+     /* get counters for sampling routine                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen       ... pointer to generator object                          */
+     /*   n_sample  ... number of generated random variates                  */
+     /*   n_trial   ... number of trials                                     */
+     /*   n_squeeze ... number of candidates accepted by squeeze             */
+     /*   n_pdf     ... number of PDF evaluations                            */
+     /*   n_search  ... number of steps in sequential search                 */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL("",gen,UNUR_ERR_NULL);
+
+#ifdef UNUR_ENABLE_STATS
+  if (n_sample)  *n_sample  = gen->stats.sample;
+  if (n_trial)   *n_trial   = gen->stats.trial;
+  if (n_squeeze) *n_squeeze = gen->stats.squeeze;
+  if (n_pdf)     *n_pdf     = gen->stats.pdf;
+  if (n_search)  *n_search  = gen->stats.search;
+  return UNUR_SUCCESS;
+#else
+  if (n_sample)  *n_sample  = 0ul;
+  if (n_trial)   *n_trial   = 0ul;
+  if (n_squeeze) *n_squeeze = 0ul;
+  if (n_pdf)     *n_pdf     = 0ul;
+  if (n_search)  *n_search  = 0ul;
+  _unur_error(gen->genid,UNUR_ERR_COMPILE,"configure with '--enable-stats'");
+  return UNUR_ERR_COMPILE;
+#endif
+} /* end of unur_gen_get_stats() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_gen_reset_stats( struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* reset counters for sampling routine                                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen       ... pointer to generator object                          */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  /* check arguments */
+  _unur_check_NULL("",gen,UNUR_ERR_NULL);
+
+#ifdef UNUR_ENABLE_STATS
+  _unur_stats_reset(gen);
+  return UNUR_SUCCESS;
+#else
+  _unur_error(gen->genid,UNUR_ERR_COMPILE,"configure with '--enable-stats'");
+  return UNUR_ERR_COMPILE;
+#endif
+} /* end of unur_gen_reset_stats() */
+
+/*---------------------------------------------------------------------------*/
+
+size_t
+unur_gen_get_memory_usage( const struct unur_gen *gen )
+     /*----------------------------------------------------------------------*/
+     /* get number of bytes occupied by generator object                     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   gen ... pointer to generator object                                */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   size of generator object in bytes                                  */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   return 0                                                           */
+     /*----------------------------------------------------------------------*/
+{
+  size_t size;
+  int i;
+
+  /* check arguments */
+  _unur_check_NULL("",gen,0);
+
+  /* generic generator object */
+  size = sizeof(struct unur_gen) + gen->s_datap;
+  if (gen->genid) size += strlen(gen->genid) + 1;
+
+#ifdef UNUR_ENABLE_INFO
+  if (gen->infostr) size += sizeof(struct unur_string) + gen->infostr->allocated;
+#endif
+
+  /* private copy of distribution object */
+  if (gen->distr_is_privatecopy)
+    size += _unur_distr_memsize(gen->distr);
+
+  /* tables of method */
+  /* (NULL for sampling contexts where the tables belong to the core) */
+  if (gen->memsize)
+    size += gen->memsize(gen);
+
+  /* auxiliary generators */
+  if (gen->gen_aux)
+    size += unur_gen_get_memory_usage(gen->gen_aux);
+  if (gen->gen_aux_list && gen->n_gen_aux_list) {
+    size += gen->n_gen_aux_list * sizeof(struct unur_gen *);
+    /* all entries may point to the same generator object */
+    /* (see _unur_gen_list_clone())                        */
+    for (i=0; i<gen->n_gen_aux_list; i++)
+      if (gen->gen_aux_list[i] && (i==0 || gen->gen_aux_list[i] != gen->gen_aux_list[0]))
+	size += unur_gen_get_memory_usage(gen->gen_aux_list[i]);
+  }
+
+  return size;
+} /* end of unur_gen_get_memory_usage() */
+
+/*---------------------------------------------------------------------------*/
 /*---------------------------------------------------------------------------*/
 
 int
@@ -563,9 +1925,12 @@ _unur_generic_create( struct unur_par *par, size_t s )
     gen->distr = (struct unur_distr *) par->distr;
 
   /* initialize function pointers */
+  gen->sample_array.cont = NULL;    /* no routine for sampling arrays */
+  gen->sample_nhpp = NULL;          /* no routine for sampling NHPP   */
   gen->destroy = NULL;              /* destructor      */ 
   gen->clone = NULL;                /* clone generator */
   gen->reinit = NULL;               /* reinit routine  */ 
+  gen->memsize = NULL;              /* memory used by tables */
 
   /* copy some parameters into generator object */
   gen->method = par->method;        /* indicates method and variant          */
@@ -579,6 +1944,13 @@ _unur_generic_create( struct unur_par *par, size_t s )
   gen->gen_aux_list = NULL;         /* no auxilliary generator objects       */
   gen->n_gen_aux_list = 0;
 
+  gen->core = NULL;                 /* not a sampling context                */
+  gen->n_contexts = 0;              /* not shared by sampling contexts       */
+  gen->free_pending = FALSE;
+
+  /* counters for sampling routine */
+  _unur_stats_reset(gen);
+
   /* status of generator object */
   gen->status = UNUR_FAILURE;       /* not successfully created yet          */
 
@@ -621,6 +1993,13 @@ _unur_generic_clone( const struct unur_gen *gen, const char *type )
   /* set generator identifier */
   clone->genid = _unur_set_genid(type);
 
+  /* clone is not shared by sampling contexts */
+  clone->n_contexts = 0;
+  clone->free_pending = FALSE;
+
+  /* counters for sampling routine */
+  _unur_stats_reset(clone);
+
 #ifdef UNUR_ENABLE_INFO
   /* do not copy pointer to info string */
   clone->infostr = NULL;
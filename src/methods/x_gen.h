@@ -134,6 +134,116 @@ int    unur_sample_matr(UNUR_GEN *generator, double *matrix);
    @var{generator} is an invalid NULL pointer.
 */
 
+int    unur_sample_cont_array(UNUR_GEN *generator, double *X, int n);
+/* */
+
+int    unur_sample_discr_array(UNUR_GEN *generator, int *K, int n);
+/*
+   Fill array @var{X} (or @var{K}, resp.) of length @var{n} with
+   random variates from a generator object for a continuous (or
+   discrete, resp.) univariate distribution.
+
+   Some methods implement special routines for generating arrays of
+   random variates which are faster than calling unur_sample_cont()
+   (or unur_sample_discr()) repeatedly. For all other methods these
+   routines are called @var{n} times.
+   Notice that the sequence of random variates generated by such a
+   special routine may differ from the sequence generated by
+   repeated calls to unur_sample_cont() (or unur_sample_discr()).
+   See the description of the particular method for details.
+
+   @code{UNUR_SUCCESS} is returned if generation was successful and
+   some error code otherwise.
+*/
+
+int    unur_sample_cont_antithetic(UNUR_GEN *generator, double *X, int n);
+/* */
+
+int    unur_sample_discr_antithetic(UNUR_GEN *generator, int *K, int n);
+/*
+   Fill array @var{X} (or @var{K}, resp.) of length @var{n} with
+   antithetic pairs of random variates, i.e., the entries with indices
+   @code{2*i} and @code{2*i+1} are generated from uniform random
+   numbers @i{U} and @i{1-U}, respectively. If @var{n} is odd, then
+   the last entry is an ordinary random variate.
+   Only one uniform random number is required for each pair.
+
+   These routines require a generator object that implements an
+   inversion method (see unur_gen_is_inversion()). Otherwise error
+   code @code{UNUR_ERR_NO_QUANTILE} is returned. 
+   Truncated domains are supported.
+*/
+
+int    unur_sample_cont_stratified(UNUR_GEN *generator, double *X, int n);
+/* */
+
+int    unur_sample_discr_stratified(UNUR_GEN *generator, int *K, int n);
+/*
+   Fill array @var{X} (or @var{K}, resp.) of length @var{n} with a
+   stratified sample, i.e., the unit interval is partitioned into
+   @var{n} intervals of equal length and exactly one random variate
+   is generated by inversion from a uniform random number in each of
+   these intervals. The entries are then randomly permuted.
+   Thus @var{d} arrays of the same length @var{n} that are generated by
+   separate calls form a Latin hypercube sample of size @var{n}
+   in dimension @var{d} (for independent marginals).
+
+   As for unur_sample_cont_antithetic() a generator object for an 
+   inversion method is required.
+*/
+
+int    unur_sample_hr_process(UNUR_GEN *generator, double T, int renewal, double *times, int size, int *n_events);
+/* */
+
+int    unur_sample_hr_process_array(UNUR_GEN *generator, double T, int renewal, double *times, int size, int *n_events, int n_comp);
+/*
+   Generate all event times in the time interval [0,@var{T}] of a
+   point process where the hazard rate of the given distribution
+   describes the failure rate of a component.
+   The event times are stored in increasing order in array
+   @var{times} of length @var{size} and their number is stored in
+   @var{n_events}.
+
+   If @var{renewal} is FALSE, then a non-homogeneous Poisson process
+   with intensity function given by the hazard rate is generated
+   (i.e., a component that is minimally repaired after each failure).
+   It starts at the left boundary of the domain of the distribution.
+   This requires a generator object for method HRB, HRD, or HRI.
+   The process is generated by thinning of a homogeneous Poisson
+   process of candidate points. The exponential spacings are drawn
+   in blocks and for method HRB the hazard rate is evaluated for a
+   whole block of candidate points at once. Spacings that are not
+   used are kept in the generator object for the next call (they
+   are discarded by unur_reinit() and when the URNG is changed).
+   For method HRB the given upper bound is used as constant
+   dominating intensity. For HRD the hazard rate at the last
+   candidate point is used. For HRI a piecewise constant dominating
+   intensity is used where the hazard rate is evaluated at the right
+   boundary of each piece.
+
+   If @var{renewal} is TRUE, then a renewal process is generated
+   (i.e., a component that is replaced by a new one after each
+   failure). Then the event times are the partial sums of
+   independent random variates that are generated by
+   @var{generator}. Any generator object for a continuous univariate
+   distribution with non-negative random variates can be used.
+
+   unur_sample_hr_process_array() generates the processes of
+   @var{n_comp} independent components in one call. Then
+   @var{times} must be an array of length
+   @code{n_comp * size} where the event times of component @var{i}
+   are stored starting at @code{times[i*size]}, and @var{n_events}
+   must be an array of length @var{n_comp} (@var{n_comp} >= 1).
+   (Use sampling contexts (see unur_gen_share()) to distribute
+   components over several threads.)
+
+   If there are more than @var{size} events for some component, then
+   only the first @var{size} event times are stored and
+   @code{UNUR_ERR_GEN_SAMPLING} is returned.
+   Otherwise @code{UNUR_SUCCESS} is returned if generation was
+   successful and some error code in case of an error.
+*/
+
 /*---------------------------------------------------------------------------*/
 /* Estimate quantiles                                                        */
 
@@ -172,6 +282,158 @@ double unur_quantile ( UNUR_GEN *generator, double U );
 void  unur_free( UNUR_GEN *generator );
 /*
   Destroy (free) the given generator object.
+
+  If there still exist sampling contexts for @var{generator}
+  (see unur_gen_share()) then the generator object is destroyed
+  together with the last of these contexts.
+*/
+
+/*---------------------------------------------------------------------------*/
+/* Sampling contexts                                                         */
+
+UNUR_GEN *unur_gen_share( UNUR_GEN *generator, UNUR_URNG *urng );
+/*
+  Create a sampling context for the given generator object.
+  A sampling context is a light-weight generator object that shares
+  all (possibly large) tables of @var{generator} but has its own
+  uniform random number generator @var{urng} and its own copy of the
+  small parts of the generator object that are changed during sampling.
+  If @var{urng} is NULL then the URNG of @var{generator} is used.
+  If @var{generator} is itself a sampling context then the new context
+  shares the tables of the original generator object.
+
+  The context can be used like any other generator object, i.e.,
+  with unur_sample_cont(), unur_sample_discr(),
+  unur_sample_cont_array(), unur_sample_discr_array(),
+  unur_gen_clone(), unur_chg_urng(), and unur_free().
+  Thus one generator object can be set up once and then used
+  in several threads, each with its own context and its own URNG.
+  Calls to sampling routines with different contexts do not interfere.
+  However, creating and destroying contexts as well as calling 
+  unur_free() for the shared generator object must not run concurrently
+  (the number of existing contexts is not maintained by an atomic counter).
+
+  Adaptive steps of methods AROU, ARS, TABL, and TDR are stopped when
+  the first sampling context is created, i.e., the tables of
+  @var{generator} are not changed any more.
+  For method DARI the auxiliary table is then computed
+  (see unur_dari_set_eagertable()).
+  Sampling contexts are only supported for methods
+  AROU, ARS, CSTD, DARI, DAU, DGT, DSTD, HINV, HRB, HRD, HRI,
+  MIXT, NINV, PINV, TABL, and TDR
+  (and for generator objects where all auxiliary generators use one of
+  these methods). Otherwise NULL is returned.
+  (The lazy variant of method DGT, see unur_dgt_set_lazy(), is not
+  supported either.)
+
+  Neither @var{generator} nor any of its contexts can be modified by
+  unur_reinit() or by @code{unur_<method>_chg_...} calls as long as
+  sampling contexts exist. These calls then fail with error code
+  @code{UNUR_ERR_GEN_INVALID} and leave the generator object unchanged.
+*/
+
+int unur_gen_is_shared( const UNUR_GEN *generator );
+/*
+  Returns TRUE if @var{generator} is a sampling context created by
+  unur_gen_share() and FALSE otherwise.
+*/
+
+/*---------------------------------------------------------------------------*/
+/* Pools of generator objects                                                */
+
+UNUR_GEN_POOL *unur_gen_pool_new( const UNUR_GEN *prototype, int n );
+/*
+  Create a pool of @var{n} generator objects that are clones of
+  @var{prototype} (see unur_gen_clone()).
+  Generator objects can then be taken from the pool by
+  unur_gen_pool_acquire() and returned by unur_gen_pool_release()
+  without calling malloc() or free().
+  Thus the pool is useful when generator objects are only needed for
+  a short time, e.g., for serving a single request in a multi-threaded
+  application.
+
+  If @var{prototype} is a sampling context (see unur_gen_share()) then
+  all generator objects in the pool are sampling contexts that share
+  the tables of the same generator object. Otherwise each generator
+  object has its own copy of all tables.
+  @var{prototype} is not used by the pool and can be destroyed
+  after this call.
+
+  @strong{Important:} All generator objects in the pool use the same
+  URNG (and auxiliary URNG) as @var{prototype}. As URNGs are not
+  thread-safe, generator objects that are used concurrently by
+  different threads must not use this shared URNG. Use
+  unur_gen_pool_acquire_urng() to acquire a generator object
+  together with a URNG that is owned by the calling thread.
+
+  In case of an error NULL is returned.
+*/
+
+UNUR_GEN *unur_gen_pool_acquire( UNUR_GEN_POOL *pool );
+/*
+  Get a generator object from the @var{pool} that is not in use.
+  NULL is returned if all generator objects are in use.
+  The generator object can then be used like any other generator
+  object. In particular, the URNG can be changed by unur_chg_urng().
+  However, it must not be destroyed by unur_free(); it has to be
+  returned to the pool by unur_gen_pool_release() instead.
+
+  Different threads can acquire and release generator objects
+  concurrently without locks. This requires a compiler that supports
+  the atomic builtins of GCC (version 4.7 or later, or clang).
+  Otherwise unur_gen_pool_acquire() and unur_gen_pool_release()
+  must not run concurrently.
+
+  @strong{Important:} The generator object still uses the shared
+  URNG of the prototype. Thus sampling from generator objects that
+  have been acquired by different threads results in a data race
+  on the state of this URNG unless each thread sets its own URNG by
+  unur_chg_urng() before sampling (or uses
+  unur_gen_pool_acquire_urng()).
+*/
+
+UNUR_GEN *unur_gen_pool_acquire_urng( UNUR_GEN_POOL *pool, UNUR_URNG *urng );
+/*
+  Same as unur_gen_pool_acquire() but additionally set the URNG and
+  the auxiliary URNG (if any) of the returned generator object to
+  @var{urng} (see unur_chg_urng()).
+  Thus each thread can use its own URNG without any race on the
+  shared URNG of the prototype.
+  NULL is returned if all generator objects are in use.
+*/
+
+int unur_gen_pool_release( UNUR_GEN_POOL *pool, UNUR_GEN *generator );
+/*
+  Return @var{generator} to the @var{pool}.
+  The parts of the generator object that are changed during sampling
+  are reset:
+  The URNG and auxiliary URNG of the prototype are restored
+  (the states of these URNGs are not changed). The URNG set by
+  unur_gen_pool_acquire_urng() or unur_chg_urng() is not used by
+  the pool any more and can be destroyed.
+  The counters of unur_gen_get_stats() are set to @code{0}.
+  A random variate that is stored by method CSTD (e.g. the second
+  variate of the polar method) is discarded.
+  The Markov chains of methods GIBBS and HITRO are reset to their
+  starting points (see unur_gibbs_reset_state() and
+  unur_hitro_reset_state()).
+  Tables that have been improved by adaptive steps (e.g. methods
+  AROU, ARS, TABL, and TDR, or the adaptive bounding rectangle of
+  method HITRO) are kept, as these remain valid. Thus the sequence of
+  random variates drawn after the generator object has been acquired
+  again may differ even if the URNG is reset.
+
+  Parameters of the distribution that have been changed by
+  @code{unur_<method>_chg_...} calls are not reset.
+
+  It is an error if @var{generator} has not been acquired from
+  @var{pool}.
+*/
+
+void unur_gen_pool_free( UNUR_GEN_POOL *pool );
+/*
+  Destroy the @var{pool} and all its generator objects.
+  All generator objects must have been returned to the pool before.
 */
 
 /*---------------------------------------------------------------------------*/
@@ -189,6 +451,83 @@ const char *unur_gen_info( UNUR_GEN *generator, int help );
    If an error occurs, then NULL is returned.
 */
 
+int unur_gen_get_stats( const UNUR_GEN *generator, unsigned long *n_sample,
+			unsigned long *n_trial, unsigned long *n_squeeze,
+			unsigned long *n_pdf, unsigned long *n_search );
+/* 
+   Get counters for the sampling routine of the given @var{generator}:
+
+   @table @var
+   @item n_sample
+   number of generated random variates;
+   @item n_trial
+   number of candidates (iterations of the rejection loop);
+   @item n_squeeze
+   number of candidates that have been accepted by the squeeze,
+   i.e., without evaluating the PDF;
+   @item n_pdf
+   number of evaluations of the PDF (or PMF) in the rejection step;
+   @item n_search
+   number of steps in the sequential search for the interval after
+   the look-up in the guide table.
+   @end table
+
+   Any of these pointers may be NULL.
+   Thus @code{n_trial/n_sample} is the observed rejection constant.
+   An increase of this number after changing parameters of the
+   distribution (e.g. by a unur_..._chg_...() call) indicates that
+   the hat function does not fit well any more and that the
+   generator object should be rebuilt.
+
+   These counters are only available for the methods AROU, ARS, DARI,
+   HITRO, ITDR, NROU, SROU, TABL, TDR, and UTDR, and only
+   if the library has been compiled with the configure flag
+   @code{--enable-stats}. Otherwise, all counters are set to @code{0} and
+   error code @code{UNUR_ERR_COMPILE} is returned.
+   For all other methods the counters are @code{0}.
+
+   The counters are reset when the generator object is created,
+   cloned, or shared (see unur_gen_share()). Each sampling context
+   has its own counters.
+*/
+
+int unur_gen_reset_stats( UNUR_GEN *generator );
+/* 
+   Reset all counters for the sampling routine of @var{generator}
+   (see unur_gen_get_stats()).
+*/
+
+/*---------------------------------------------------------------------------*/
+/* Get memory used by generator object                                       */
+
+size_t unur_gen_get_memory_usage( const UNUR_GEN *generator );
+/* 
+   Get the number of bytes occupied by the given @var{generator}.
+   This includes the generator object itself, its tables (e.g. guide
+   tables, lists of intervals, or coefficients of interpolating
+   polynomials), its private copy of the distribution object, and all
+   auxiliary generator objects.
+   Thus it can be used to estimate the memory that is required to keep
+   a large number of generator objects, or to detect generators where
+   the number of intervals became unexpectedly large.
+
+   Tables are accounted for the methods AROU, ARS, CSTD, DARI, DAU,
+   DGT, DSS, DSTD, EMPL, HINV, HIST, MVTDR, NINV, PINV, TABL, TDR,
+   and VEMPK. For all other methods only the generator object, the
+   distribution object, and the auxiliary generators are counted.
+   Small working arrays of some multivariate methods are not included.
+   The overhead of the memory allocator is not included either.
+
+   A sampling context (see unur_gen_share()) only counts the memory
+   that it does not share with its generator object.
+   A distribution object is only counted when the generator object
+   keeps a private copy (see unur_set_use_distr_privatecopy()).
+   Arrays that are shared between several distribution objects
+   (see unur_set_use_distr_privatecopy()) are counted proportionally.
+
+   If an error occurs, then @code{0} is returned.
+*/
+
 /*---------------------------------------------------------------------------*/
 /* Get dimension of generator for (multivariate) distribution                */
 
@@ -261,6 +600,13 @@ int unur_set_use_distr_privatecopy( UNUR_PAR *parameters, int use_privatecopy );
    independently from other UNU.RAN objects (with uniform random number
    generators as the only exception). When the generator object is
    initialized the given distribution object is cloned and stored.
+   Large arrays of the distribution object, i.e., the probability
+   vector of a discrete distribution and the covariance and rank
+   correlation matrices (and their Cholesky factors and inverses)
+   of a multivariate distribution, are not copied. They are shared
+   with the clone until either of the two objects is changed
+   (copy-on-write). Thus cloning distribution objects with large
+   probability vectors or large matrices is cheap.
 
    However, in some rare situations it can be useful when only the
    pointer to the given distribution object is stored without making a
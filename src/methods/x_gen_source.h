@@ -89,6 +89,74 @@ struct unur_gen *_unur_generic_clone( const struct unur_gen *gen, const char *ty
 
 void _unur_generic_free( struct unur_gen *gen );
 
+/*---------------------------------------------------------------------------*/
+/* counters for sampling routines (see unur_gen_get_stats())                 */
+
+#ifdef UNUR_ENABLE_STATS
+#  define _unur_stats_count(gen,counter)  (++((gen)->stats.counter))
+#  define _unur_stats_reset(gen) \
+     memset( &((gen)->stats), 0, sizeof(struct unur_gen_stats) )
+#else
+#  define _unur_stats_count(gen,counter)  do {} while(0)
+#  define _unur_stats_reset(gen)          do {} while(0)
+#endif
+
+void _unur_gen_info_stats( struct unur_gen *gen );
+/* append counters of sampling routine to info string                        */
+
+/*---------------------------------------------------------------------------*/
+/* variance reduction for inversion methods                                  */
+
+#define UNUR_SAMPLE_VR_ANTITHETIC   (1)   /* antithetic pairs                */
+#define UNUR_SAMPLE_VR_STRATIFIED   (2)   /* stratified sample               */
+
+int _unur_sample_vr( struct unur_gen *gen, double *X, int *K, int n, int variant );
+/* fill array with random variates using variance reduction technique        */
+
+/*---------------------------------------------------------------------------*/
+/* cache for PDF values                                                      */
+
+void _unur_gen_remove_pdfcache( struct unur_gen *gen );
+/* remove cache for PDF values from distribution objects of generator        */
+
+/*---------------------------------------------------------------------------*/
+/* point processes with given hazard rate                                    */
+
+struct unur_hr_spacings;        /* see x_gen_struct.h */
+
+void _unur_hr_spacings_reset( struct unur_hr_spacings *sp );
+/* discard all spacings in block                                             */
+
+int _unur_hr_spacings_fill( struct unur_gen *gen, struct unur_hr_spacings *sp );
+/* make sure that block contains unused exponential spacings                 */
+
+double _unur_hr_spacings_next( struct unur_gen *gen, struct unur_hr_spacings *sp );
+/* get next exponential spacing from block                                   */
+
+int _unur_sample_hr_renewal( struct unur_gen *gen, double T, double *times, int size, int *n_events );
+/* generate renewal process                                                  */
+
+/*---------------------------------------------------------------------------*/
+/* sampling contexts that share the tables of a generator object             */
+
+int _unur_gen_share_prepare( struct unur_gen *gen );
+/* check whether generator object can be shared and stop adaptive steps      */
+
+struct unur_gen *_unur_gen_share_make( struct unur_gen *core, UNUR_URNG *urng );
+/* create sampling context for generator object                              */
+
+struct unur_gen *_unur_gen_share_clone( const struct unur_gen *ctx );
+/* create new sampling context for the same generator object                 */
+
+void _unur_gen_share_free( struct unur_gen *ctx );
+/* destroy sampling context                                                  */
+
+/*---------------------------------------------------------------------------*/
+/* pools of generator objects                                                */
+
+void _unur_gen_pool_reset( struct unur_gen *gen );
+/* reset mutable parts of generator object when it is returned to pool       */
+
 /*---------------------------------------------------------------------------*/
 /* set and clone arrays of generator objects                                 */
 
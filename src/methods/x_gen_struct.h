@@ -46,6 +46,12 @@ typedef int UNUR_SAMPLING_ROUTINE_DISCR(struct unur_gen *gen);
 /* for multivariate continuous distribution */
 typedef int UNUR_SAMPLING_ROUTINE_CVEC(struct unur_gen *gen, double *vec);
 
+/* for arrays of univariate continuous random variates */
+typedef int UNUR_SAMPLING_ROUTINE_CONT_ARRAY(struct unur_gen *gen, double *X, int n);
+
+/* for arrays of univariate discrete random variates */
+typedef int UNUR_SAMPLING_ROUTINE_DISCR_ARRAY(struct unur_gen *gen, int *K, int n);
+
 
 /*---------------------------------------------------------------------------*/
 /* parameter objects                                                         */
@@ -92,6 +98,19 @@ struct unur_par {
 /*---------------------------------------------------------------------------*/
 /* generator objects                                                         */
 
+#ifdef UNUR_ENABLE_STATS
+/* counters for sampling routines (see unur_gen_get_stats())                 */
+struct unur_gen_stats {
+  unsigned long sample;       /* number of generated random variates         */
+  unsigned long trial;        /* number of candidates (iterations of
+				 rejection loop)                             */
+  unsigned long squeeze;      /* number of candidates accepted by squeeze    */
+  unsigned long pdf;          /* number of evaluations of PDF or PMF         */
+  unsigned long search;       /* number of steps in (sequential) search for
+				 interval after guide table look-up          */
+};
+#endif
+
 struct unur_gen { 
   void *datap;                /* pointer to data for method                  */
   
@@ -101,6 +120,18 @@ struct unur_gen {
     UNUR_SAMPLING_ROUTINE_CVEC  *cvec;
     UNUR_SAMPLING_ROUTINE_CVEC  *matr;
   } sample;                   /* pointer to sampling routine                 */
+
+  union {
+    UNUR_SAMPLING_ROUTINE_CONT_ARRAY  *cont;
+    UNUR_SAMPLING_ROUTINE_DISCR_ARRAY *discr;
+  } sample_array;             /* pointer to routine for sampling arrays
+				 (optional, NULL if not available)           */
+
+  int (*sample_nhpp)(struct unur_gen *gen, double T, double *times, int size, int *n_events);
+                              /* pointer to routine for sampling the event
+				 times of the non-homogeneous Poisson process
+				 with the hazard rate as intensity function
+				 (optional, NULL if not available)           */
   
   UNUR_URNG *urng;            /* pointer to uniform random number generator  */
   UNUR_URNG *urng_aux;        /* pointer to second (auxiliary) uniform RNG   */
@@ -139,9 +170,22 @@ struct unur_gen {
   size_t s_datap;             /* size of data structure                      */
   unsigned debug;             /* debugging flags                             */
 
+  struct unur_gen *core;      /* generator object that is shared by this
+				 sampling context (NULL if gen is not a
+				 sampling context)                           */
+  int n_contexts;             /* number of sampling contexts that share
+				 this generator object                       */
+  int free_pending;           /* whether unur_free() has been called while
+				 sampling contexts still exist               */
+
   void (*destroy)(struct unur_gen *gen); /* pointer to destructor            */ 
   struct unur_gen* (*clone)(const struct unur_gen *gen ); /* clone generator */
   int (*reinit)(struct unur_gen *gen); /* pointer to reinit routine          */ 
+  size_t (*memsize)(const struct unur_gen *gen); /* memory used by tables    */
+
+#ifdef UNUR_ENABLE_STATS
+  struct unur_gen_stats stats; /* counters for sampling routine              */
+#endif
 
 #ifdef UNUR_ENABLE_INFO
   struct unur_string *infostr; /* pointer to info string                     */
@@ -154,3 +198,32 @@ struct unur_gen {
 };
 
 /*---------------------------------------------------------------------------*/
+/* block of exponential spacings for point processes                         */
+/* (see _unur_hr_spacings_next())                                            */
+
+#define UNUR_HR_SPACINGS_BLOCK  (64)
+
+struct unur_hr_spacings {
+  double E[UNUR_HR_SPACINGS_BLOCK]; /* block of standard exponential spacings */
+  int next;                   /* index of next unused spacing in block       */
+  const struct unur_gen *gen; /* generator object that has drawn the block   */
+  const UNUR_URNG *urng;      /* URNG that has been used for the block       */
+};
+
+/*---------------------------------------------------------------------------*/
+/* pools of generator objects                                                */
+
+struct unur_gen_pool {
+  struct unur_gen **gen;      /* generator objects in pool                   */
+  int *in_use;                /* flags whether object has been acquired      */
+  int n_gen;                  /* number of generator objects in pool         */
+  unsigned next;              /* slot where search for free object starts    */
+  UNUR_URNG *urng;            /* URNG of prototype                           */
+  UNUR_URNG *urng_aux;        /* auxiliary URNG of prototype                 */
+
+#ifdef UNUR_COOKIES
+  unsigned cookie;            /* magic cookie                                */
+#endif
+};
+
+/*---------------------------------------------------------------------------*/
@@ -553,6 +553,12 @@ static double _unur_fstr_eval_node (const struct ftreenode *node, double x);
 /* Evaluate function tree starting from `node' at x                          */
 /*---------------------------------------------------------------------------*/
 
+static double _unur_fstr_eval_node_dual (const struct ftreenode *node, double x, double *dval);
+/*---------------------------------------------------------------------------*/
+/* Evaluate function tree starting from `node' at x together with its        */
+/* derivative (forward mode automatic differentiation).                      */
+/*---------------------------------------------------------------------------*/
+
 
 /**-------------------------------------------------------------------------**/
 /** functparser_deriv.c                                                     **/
@@ -55,6 +55,14 @@ double _unur_fstr_eval_tree ( const struct ftreenode *functtree_root, double x )
 /* Evalutes function given by a function tree at x.                          */
 /*---------------------------------------------------------------------------*/
 
+double _unur_fstr_eval_deriv_tree ( const struct ftreenode *functtree_root, double x, double *fx );
+/*---------------------------------------------------------------------------*/
+/* Evalutes derivative of function given by a function tree at x.            */
+/* The derivative is computed by automatic differentiation (forward mode)    */
+/* in the same pass through the tree as the function value, which is stored  */
+/* in fx (if fx is not NULL).                                                */
+/*---------------------------------------------------------------------------*/
+
 struct ftreenode *_unur_fstr_dup_tree (const struct ftreenode *functtree_root);
 /*---------------------------------------------------------------------------*/
 /* Duplicate function tree rooted at root.                                   */
@@ -65,6 +73,11 @@ void _unur_fstr_free ( struct ftreenode *functtree_root );
 /* Destroys function tree and frees memory.                                  */
 /*---------------------------------------------------------------------------*/
 
+size_t _unur_fstr_tree_memsize ( const struct ftreenode *functtree_root );
+/*---------------------------------------------------------------------------*/
+/* Returns number of bytes occupied by function tree.                        */
+/*---------------------------------------------------------------------------*/
+
 char *_unur_fstr_tree2string ( const struct ftreenode *functtree_root,
 			       const char *variable, const char *function, int spaces );
 /*---------------------------------------------------------------------------*/
@@ -96,6 +96,28 @@ static double v_abs    (double l, double r);
 static double v_sgn    (double l, double r);
 #endif
 
+/*****************************************************************************/
+/** Routines for evaluating derivatives of nodes (forward mode)             **/
+/*****************************************************************************/
+
+#ifdef PARSER
+static double dv_error (double v, double l, double dl, double r, double dr);
+static double dv_zero  (double v, double l, double dl, double r, double dr);
+static double dv_plus  (double v, double l, double dl, double r, double dr);
+static double dv_minus (double v, double l, double dl, double r, double dr);
+static double dv_mul   (double v, double l, double dl, double r, double dr);
+static double dv_div   (double v, double l, double dl, double r, double dr);
+static double dv_power (double v, double l, double dl, double r, double dr);
+static double dv_exp   (double v, double l, double dl, double r, double dr);
+static double dv_log   (double v, double l, double dl, double r, double dr);
+static double dv_sin   (double v, double l, double dl, double r, double dr);
+static double dv_cos   (double v, double l, double dl, double r, double dr);
+static double dv_tan   (double v, double l, double dl, double r, double dr);
+static double dv_sec   (double v, double l, double dl, double r, double dr);
+static double dv_sqrt  (double v, double l, double dl, double r, double dr);
+static double dv_abs   (double v, double l, double dl, double r, double dr);
+#endif
+
 /*****************************************************************************/
 /** Routines for computing derivatives                                      **/
 /*****************************************************************************/
@@ -280,6 +302,10 @@ struct symbols {
                                  /* function for computing value of node     */
   struct ftreenode *(*dcalc)(const struct ftreenode *node, int *error); 
                                  /* function for computing derivate          */
+  double (*dvcalc)(double v, double l, double dl, double r, double dr);
+                                 /* function for evaluating derivative of
+				    node (v = value of node, l,r = values of
+				    branches, dl,dr = their derivatives)     */
 #endif
 
 #ifdef CODEGEN
@@ -319,10 +345,10 @@ struct symbols {
 
 /* entries needed for parsing and evaluation of terms */
 #ifdef PARSER
-#  define S(name,type,priority,value,funct,deriv) \
-   name,type,priority,value,funct,deriv
+#  define S(name,type,priority,value,funct,deriv,dval) \
+   name,type,priority,value,funct,deriv,dval
 #else
-#  define S(name,type,priority,value,funct,deriv) \
+#  define S(name,type,priority,value,funct,deriv,dval) \
    name,
 #endif
 
@@ -334,71 +360,72 @@ struct symbols {
 #endif
 
 static struct symbols symbol[] = {   
-  /*  symbol,	         priority, evaluation routine,     C function,          Java function */
-  /*          type,          value,           derivative              F function,             */
+  /*  symbol,	         priority, evaluation routine,                C function,          Java function */
+  /*          type,          value,           derivative,               F function,             */
+  /*                                                   value of derivative                               */
 
   /* void */
-  {S (""    , S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
+  {S (""    , S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
 
   /* user defined symbols: */                        
   /*    constant           */                     
-  {S ("UCONST",S_UCONST , 9, 0.0 , v_const  , d_const) CG (C_const  , F_const , J_const  )},
+  {S ("UCONST",S_UCONST , 9, 0.0 , v_const  , d_const, dv_zero ) CG (C_const  , F_const , J_const  )},
   /*    function           */
-  {S ("UFUNCT",S_UFUNCT , 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
+  {S ("UFUNCT",S_UFUNCT , 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
   /*    variable           */
-  {S ("VAR" , S_UIDENT  , 9, 0.0 , v_dummy  , d_var  ) CG (C_var    , F_var   , J_var    )},
+  {S ("VAR" , S_UIDENT  , 9, 0.0 , v_dummy  , d_var  , dv_zero ) CG (C_var    , F_var   , J_var    )},
 
   /* marker for relation operators */
-  {S ("_ROS", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
+  {S ("_ROS", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
 
   /* relation operators  */
-  {S ("<"   , S_REL_OP  , 1, 0.0 , v_less   , d_const) CG (C_infix  , F_lt    , J_lt     )},
-  {S ("="   , S_REL_OP  , 1, 0.0 , v_equal  , d_const) CG (C_equal  , F_eq    , J_eq     )},
-  {S ("=="  , S_REL_OP  , 1, 0.0 , v_equal  , d_const) CG (C_equal  , F_eq    , J_eq     )},
-  {S (">"   , S_REL_OP  , 1, 0.0 , v_greater, d_const) CG (C_infix  , F_gt    , J_gt     )},
-  {S ("<="  , S_REL_OP  , 1, 0.0 , v_less_or, d_const) CG (C_infix  , F_le    , J_le     )},
-  {S ("<>"  , S_REL_OP  , 1, 0.0 , v_unequal, d_const) CG (C_unequal, F_ne    , J_ne     )},
-  {S ("!="  , S_REL_OP  , 1, 0.0 , v_unequal, d_const) CG (C_unequal, F_ne    , J_ne     )},
-  {S (">="  , S_REL_OP  , 1, 0.0 , v_grtr_or, d_const) CG (C_infix  , F_ge    , J_ge     )},
+  {S ("<"   , S_REL_OP  , 1, 0.0 , v_less   , d_const, dv_zero ) CG (C_infix  , F_lt    , J_lt     )},
+  {S ("="   , S_REL_OP  , 1, 0.0 , v_equal  , d_const, dv_zero ) CG (C_equal  , F_eq    , J_eq     )},
+  {S ("=="  , S_REL_OP  , 1, 0.0 , v_equal  , d_const, dv_zero ) CG (C_equal  , F_eq    , J_eq     )},
+  {S (">"   , S_REL_OP  , 1, 0.0 , v_greater, d_const, dv_zero ) CG (C_infix  , F_gt    , J_gt     )},
+  {S ("<="  , S_REL_OP  , 1, 0.0 , v_less_or, d_const, dv_zero ) CG (C_infix  , F_le    , J_le     )},
+  {S ("<>"  , S_REL_OP  , 1, 0.0 , v_unequal, d_const, dv_zero ) CG (C_unequal, F_ne    , J_ne     )},
+  {S ("!="  , S_REL_OP  , 1, 0.0 , v_unequal, d_const, dv_zero ) CG (C_unequal, F_ne    , J_ne     )},
+  {S (">="  , S_REL_OP  , 1, 0.0 , v_grtr_or, d_const, dv_zero ) CG (C_infix  , F_ge    , J_ge     )},
 
   /* marker for non-alphanumeric symbols */
-  {S ("_NAS", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
+  {S ("_NAS", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
 
   /* special symbols */
-  {S ("("   , S_OTHERS  , 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
-  {S (")"   , S_OTHERS  , 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
-  {S (","   , S_OTHERS  , 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
+  {S ("("   , S_OTHERS  , 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
+  {S (")"   , S_OTHERS  , 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
+  {S (","   , S_OTHERS  , 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
 
   /* arithmetic operators */
-  {S ("+"   , S_ADD_OP  , 2, 0.0 , v_plus   , d_add  ) CG (C_infix  , F_infix , J_infix  )},
-  {S ("-"   , S_ADD_OP  , 2, 0.0 , v_minus  , d_add  ) CG (C_minus  , F_minus , J_minus  )},
-  {S ("*"   , S_MUL_OP  , 4, 0.0 , v_mul    , d_mul  ) CG (C_infix  , F_infix , J_infix  )},
-  {S ("/"   , S_MUL_OP  , 4, 0.0 , v_div    , d_div  ) CG (C_infix  , F_infix , J_infix  )},
-  {S ("^"   , S_HPR_OP  , 5, 0.0 , v_power  , d_power) CG (C_power  , F_power , J_power  )},
+  {S ("+"   , S_ADD_OP  , 2, 0.0 , v_plus   , d_add  , dv_plus ) CG (C_infix  , F_infix , J_infix  )},
+  {S ("-"   , S_ADD_OP  , 2, 0.0 , v_minus  , d_add  , dv_minus) CG (C_minus  , F_minus , J_minus  )},
+  {S ("*"   , S_MUL_OP  , 4, 0.0 , v_mul    , d_mul  , dv_mul  ) CG (C_infix  , F_infix , J_infix  )},
+  {S ("/"   , S_MUL_OP  , 4, 0.0 , v_div    , d_div  , dv_div  ) CG (C_infix  , F_infix , J_infix  )},
+  {S ("^"   , S_HPR_OP  , 5, 0.0 , v_power  , d_power, dv_power) CG (C_power  , F_power , J_power  )},
 
   /* marker for alphanumeric symbols */
-  {S ("_ANS", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error  )},
+  {S ("_ANS", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error  )},
 
   /* logical operators: removed */
 
   /* system constants */
-  {S ("pi"  , S_SCONST  , 9, M_PI, v_const  , d_const) CG (C_const  , F_const , J_const  )},
-  {S ("e"   , S_SCONST  , 9, M_E , v_const  , d_const) CG (C_const  , F_const , J_const  )},
+  {S ("pi"  , S_SCONST  , 9, M_PI, v_const  , d_const, dv_zero ) CG (C_const  , F_const , J_const  )},
+  {S ("e"   , S_SCONST  , 9, M_E , v_const  , d_const, dv_zero ) CG (C_const  , F_const , J_const  )},
 
   /* system functions */
-  {S ("mod" , S_SFUNCT  , 2, 0.0 , v_mod    , d_const) CG (C_mod    , F_prefix, J_mod    )},
-  {S ("exp" , S_SFUNCT  , 1, 0.0 , v_exp    , d_exp  ) CG (C_prefix , F_prefix, J_prefix )},
-  {S ("log" , S_SFUNCT  , 1, 0.0 , v_log    , d_log  ) CG (C_prefix , F_prefix, J_prefix )},
-  {S ("sin" , S_SFUNCT  , 1, 0.0 , v_sin    , d_sin  ) CG (C_prefix , F_prefix, J_prefix )},
-  {S ("cos" , S_SFUNCT  , 1, 0.0 , v_cos    , d_cos  ) CG (C_prefix , F_prefix, J_prefix )},
-  {S ("tan" , S_SFUNCT  , 1, 0.0 , v_tan    , d_tan  ) CG (C_prefix , F_prefix, J_prefix )},
-  {S ("sec" , S_SFUNCT  , 1, 0.0 , v_sec    , d_sec  ) CG (C_sec    , F_sec   , J_sec    )},
-  {S ("sqrt", S_SFUNCT  , 1, 0.0 , v_sqrt   , d_sqrt ) CG (C_prefix , F_prefix, J_prefix )},
-  {S ("abs" , S_SFUNCT  , 1, 0.0 , v_abs    , d_abs  ) CG (C_abs    , F_prefix, J_prefix )},
-  {S ("sgn" , S_SFUNCT  , 1, 0.0 , v_sgn    , d_const) CG (C_sgn    , F_sgn   , J_sgn    )},
+  {S ("mod" , S_SFUNCT  , 2, 0.0 , v_mod    , d_const, dv_zero ) CG (C_mod    , F_prefix, J_mod    )},
+  {S ("exp" , S_SFUNCT  , 1, 0.0 , v_exp    , d_exp  , dv_exp  ) CG (C_prefix , F_prefix, J_prefix )},
+  {S ("log" , S_SFUNCT  , 1, 0.0 , v_log    , d_log  , dv_log  ) CG (C_prefix , F_prefix, J_prefix )},
+  {S ("sin" , S_SFUNCT  , 1, 0.0 , v_sin    , d_sin  , dv_sin  ) CG (C_prefix , F_prefix, J_prefix )},
+  {S ("cos" , S_SFUNCT  , 1, 0.0 , v_cos    , d_cos  , dv_cos  ) CG (C_prefix , F_prefix, J_prefix )},
+  {S ("tan" , S_SFUNCT  , 1, 0.0 , v_tan    , d_tan  , dv_tan  ) CG (C_prefix , F_prefix, J_prefix )},
+  {S ("sec" , S_SFUNCT  , 1, 0.0 , v_sec    , d_sec  , dv_sec  ) CG (C_sec    , F_sec   , J_sec    )},
+  {S ("sqrt", S_SFUNCT  , 1, 0.0 , v_sqrt   , d_sqrt , dv_sqrt ) CG (C_prefix , F_prefix, J_prefix )},
+  {S ("abs" , S_SFUNCT  , 1, 0.0 , v_abs    , d_abs  , dv_abs  ) CG (C_abs    , F_prefix, J_prefix )},
+  {S ("sgn" , S_SFUNCT  , 1, 0.0 , v_sgn    , d_const, dv_zero ) CG (C_sgn    , F_sgn   , J_sgn    )},
 
   /* marker for end-of-table */
-  {S ("_END", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error) CG (C_error  , F_error , J_error )},
+  {S ("_END", S_NOSYMBOL, 0, 0.0 , v_dummy  , d_error, dv_error) CG (C_error  , F_error , J_error )},
 };
 
 #undef S
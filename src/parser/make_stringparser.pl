@@ -111,6 +111,7 @@ my %IGNORED_COMMANDS =
       'unur_distr_discr_set_cdf'    => 1,
       'unur_distr_discr_set_logcdf' => 1,
       'unur_mixt_set_useinversion'  => 1,
+      'unur_mixt_set_fused'         => 1,
     );
 
 # distributions ignored by string parser
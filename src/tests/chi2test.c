@@ -254,7 +254,7 @@ _unur_test_chi2_discr( struct unur_gen *gen,
   /* free memory */
   free(observed);
   if (!had_PV) {
-    free (DISTR.pv);
+    _unur_shared_free (DISTR.pv);
     DISTR.pv = NULL;
     DISTR.n_pv = 0;
   }
@@ -0,0 +1,620 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: urng_lattice.c                                                    *
+ *                                                                           *
+ *   routines to get new URNG object for built-in generator of points of     *
+ *   rank-1 lattice rules with skip-ahead and random shifts.                 *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   References:                                                             *
+ *                                                                           *
+ *   [1] Sloan, I.H. and Joe, S. (1994),                                     *
+ *       Lattice Methods for Multiple Integration.                           *
+ *       Oxford University Press.                                            *
+ *                                                                           *
+ *   [2] Cranley, R. and Patterson T.N.L. (1976),                            *
+ *       Randomization of number theoretic methods for multiple integration. *
+ *       SIAM J. Num. Anal. 13, 904-914.                                     *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2006 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#include <unur_source.h>
+/*---------------------------------------------------------------------------*/
+#if defined(UNUR_URNG_UNURAN)
+/*---------------------------------------------------------------------------*/
+#include <urng/urng.h>
+#include "urng_lattice.h"
+/*---------------------------------------------------------------------------*/
+
+#define LATTICE_MAXPOINTS (2147483648UL)  /* maximal number of points (2^31) */
+#define LATTICE_SEARCH    (16777216.)     /* maximal number of terms that are
+					     evaluated for search of Korobov
+					     generating vector                */
+
+/* structure for storing generator */
+struct unur_urng_lattice {
+  unsigned long *z;      /* generating vector                                */
+  unsigned long *x;      /* current point: k*z mod N                         */
+  double *shift;         /* random shift                                     */
+  unsigned long N;       /* number of points                                 */
+  unsigned long n;       /* index of current point                           */
+  unsigned long start;   /* index of first point of current substream        */
+  double invN;           /* 1/N                                              */
+  UNUR_URNG *srng;       /* generator for random shifts                      */
+  unsigned dim;          /* dimension of points                              */
+  unsigned coord;        /* current coordinate                               */
+};
+
+/*---------------------------------------------------------------------------*/
+
+static double _unur_urng_lattice_sample( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Sample next coordinate of random point.                                   */
+/* Skip to first coordinate of next point after last coordinate.             */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_urng_lattice_sample_array( struct unur_urng_lattice *lat, double *X, int dim );
+/*---------------------------------------------------------------------------*/
+/* Sample random point and store in X. use only the first dim coordinates    */
+/* if dim is less than the dimension of the generated points.                */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_free( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Free generator object.                                                    */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_reset( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Reset generator object.                                                   */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_nextpoint( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Skip to first coordinate of next point.                                   */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_nextsub( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Skip to next substream (new random shift).                                */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_resetsub( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Reset current substream.                                                  */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_setpoint( struct unur_urng_lattice *lat, unsigned long index );
+/*---------------------------------------------------------------------------*/
+/* Compute point with given index.                                           */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_advance( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Compute next point.                                                       */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_lattice_korobov( struct unur_urng_lattice *lat );
+/*---------------------------------------------------------------------------*/
+/* Compute Korobov generating vector.                                        */
+/*---------------------------------------------------------------------------*/
+
+static unsigned long _unur_urng_lattice_mulmod( unsigned long a, unsigned long b, unsigned long m );
+/*---------------------------------------------------------------------------*/
+/* Compute a*b mod m without overflow.                                       */
+/*---------------------------------------------------------------------------*/
+
+static unsigned long _unur_urng_lattice_gcd( unsigned long a, unsigned long b );
+/*---------------------------------------------------------------------------*/
+/* Greatest common divisor of a and b.                                       */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_urng_lattice_sample( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Sample next coordinate of random point.                              */
+     /* Skip to first coordinate of next point after last coordinate.        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   next coordinate                                                    */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned j = lat->coord;
+  double u;
+
+  u = lat->x[j] * lat->invN + lat->shift[j];
+  if (u >= 1.) u -= 1.;
+
+  if (++(lat->coord) == lat->dim) {
+    /* last coordinate --> compute next point */
+    _unur_urng_lattice_advance(lat);
+    lat->coord = 0u;
+  }
+
+  return u;
+} /* end of _unur_urng_lattice_sample() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_urng_lattice_sample_array( struct unur_urng_lattice *lat, double *X, int dim )
+     /*----------------------------------------------------------------------*/
+     /* Sample random point and store in X. use only the first dim coordin.  */
+     /* if dim is less than the dimension of the generated points.           */
+     /* Return number of entries filled into array X.                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*   X   ... pointer to array of length dim                             */
+     /*   dim ... (maximal) number of entries in X to be set                 */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   number of uniform random numbers filled into array                 */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned j;
+
+  if (dim <= 0) return 0;
+  if ((unsigned)dim > lat->dim) dim = (int) lat->dim;
+
+  /* we always start with the first coordinate of a new point */
+  _unur_urng_lattice_nextpoint(lat);
+
+  for (j=0; j<(unsigned)dim; j++) {
+    X[j] = lat->x[j] * lat->invN + lat->shift[j];
+    if (X[j] >= 1.) X[j] -= 1.;
+  }
+
+  _unur_urng_lattice_advance(lat);
+
+  return dim;
+} /* end of _unur_urng_lattice_sample_array() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_advance( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Compute next point.                                                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned j;
+
+  if (++(lat->n) == lat->N) {
+    /* all points used --> start again with first point */
+    lat->n = 0UL;
+    for (j=0; j<lat->dim; j++)
+      lat->x[j] = 0UL;
+    return;
+  }
+
+  for (j=0; j<lat->dim; j++) {
+    lat->x[j] += lat->z[j];
+    if (lat->x[j] >= lat->N) lat->x[j] -= lat->N;
+  }
+} /* end of _unur_urng_lattice_advance() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_setpoint( struct unur_urng_lattice *lat, unsigned long index )
+     /*----------------------------------------------------------------------*/
+     /* Compute point with given index.                                      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat   ... pointer to URNG object                                   */
+     /*   index ... index of point                                           */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned j;
+
+  index %= lat->N;
+  for (j=0; j<lat->dim; j++)
+    lat->x[j] = _unur_urng_lattice_mulmod(index, lat->z[j], lat->N);
+
+  lat->n = index;
+  lat->coord = 0u;
+} /* end of _unur_urng_lattice_setpoint() */
+
+/*---------------------------------------------------------------------------*/
+
+unsigned long
+_unur_urng_lattice_mulmod( unsigned long a, unsigned long b, unsigned long m )
+     /*----------------------------------------------------------------------*/
+     /* Compute a*b mod m without overflow (m <= 2^31).                      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   a, b ... factors                                                   */
+     /*   m    ... modulus                                                   */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned long r = 0UL;
+
+  a %= m;
+  b %= m;
+  while (b > 0UL) {
+    if (b & 1UL) {
+      r += a;
+      if (r >= m) r -= m;
+    }
+    a += a;
+    if (a >= m) a -= m;
+    b >>= 1;
+  }
+
+  return r;
+} /* end of _unur_urng_lattice_mulmod() */
+
+/*---------------------------------------------------------------------------*/
+
+unsigned long
+_unur_urng_lattice_gcd( unsigned long a, unsigned long b )
+     /*----------------------------------------------------------------------*/
+     /* Greatest common divisor of a and b.                                  */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned long t;
+
+  while (b > 0UL) {
+    t = a % b;
+    a = b;
+    b = t;
+  }
+  return a;
+} /* end of _unur_urng_lattice_gcd() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_korobov( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Compute Korobov generating vector z = (1, a, a^2, ...) mod N.        */
+     /* The parameter a minimizes the weighted P_2 criterion                 */
+     /*                                                                      */
+     /*   P_2 = -1 + 1/N sum_k prod_j (1 + gamma_j 2 pi^2 B_2({k z_j / N}))  */
+     /*                                                                      */
+     /* with weights gamma_j = 1/j^2 and Bernoulli polynomial                */
+     /* B_2(x) = x^2 - x + 1/6 [1].                                          */
+     /* If N or the dimension is large we only try a limited number of       */
+     /* candidates for a.                                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+#define TWO_PI_SQ (19.739208802178716)   /* 2 pi^2 */
+
+  unsigned long N = lat->N;
+  unsigned long a, a_opt, k, n_cand, i;
+  unsigned long *zk;
+  double P, P_opt, prod, y;
+  unsigned j;
+
+  /* number of candidates */
+  n_cand = N/2;
+  y = LATTICE_SEARCH / ((double)N * lat->dim);
+  if (y < (double) n_cand)
+    n_cand = (y < 1.) ? 1UL : (unsigned long) y;
+
+  zk = _unur_xmalloc( lat->dim * sizeof(unsigned long) );
+
+  a_opt = 1UL;
+  P_opt = UNUR_INFINITY;
+
+  for (i=1; i<=n_cand && N > 2UL; i++) {
+
+    /* candidate */
+    if (n_cand == N/2)
+      a = i;
+    else
+      /* spread candidates over [1,N/2] using golden ratio */
+      a = 1UL + (unsigned long) ((N/2 - 1) * fmod(i * 0.6180339887498949, 1.));
+    if (n_cand == N/2) {
+      if (_unur_urng_lattice_gcd(a,N) != 1UL) continue;
+    }
+    else {
+      /* step forward to next a that is relatively prime to N */
+      while (_unur_urng_lattice_gcd(a,N) != 1UL) ++a;
+    }
+
+    if (n_cand == 1UL) {
+      /* only one candidate: no need to compute criterion */
+      a_opt = a;
+      break;
+    }
+
+    /* generating vector */
+    lat->z[0] = 1UL;
+    for (j=1; j<lat->dim; j++)
+      lat->z[j] = _unur_urng_lattice_mulmod(lat->z[j-1], a, N);
+
+    /* criterion */
+    for (j=0; j<lat->dim; j++) zk[j] = 0UL;
+    P = 0.;
+    for (k=0; k<N; k++) {
+      prod = 1.;
+      for (j=0; j<lat->dim; j++) {
+	y = zk[j] * lat->invN;
+	prod *= 1. + TWO_PI_SQ * (y*y - y + 1./6.) / ((j+1.)*(j+1.));
+	zk[j] += lat->z[j];
+	if (zk[j] >= N) zk[j] -= N;
+      }
+      P += prod;
+    }
+
+    if (P < P_opt) {
+      P_opt = P;
+      a_opt = a;
+    }
+  }
+
+  /* store optimal generating vector */
+  lat->z[0] = 1UL;
+  for (j=1; j<lat->dim; j++)
+    lat->z[j] = _unur_urng_lattice_mulmod(lat->z[j-1], a_opt, N);
+
+  free(zk);
+
+#undef TWO_PI_SQ
+} /* end of _unur_urng_lattice_korobov() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_free( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Free URNG object.                                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+  if (lat) {
+    free( lat->z );
+    free( lat->x );
+    free( lat->shift );
+    free( lat );
+  }
+} /* end of _unur_urng_lattice_free() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_reset( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Reset URNG object: jump to first point of lattice.                   */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+  lat->start = 0UL;
+  _unur_urng_lattice_setpoint(lat,0UL);
+} /* end of _unur_urng_lattice_reset() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_nextpoint( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Skip to first coordinate of next point.                              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+  if (lat->coord > 0u) {
+    _unur_urng_lattice_advance(lat);
+    lat->coord = 0u;
+  }
+} /* end of _unur_urng_lattice_nextpoint() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_nextsub( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Skip to next substream, i.e., draw new random shift and jump to      */
+     /* first point of substream.                                            */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+  if (lat->srng)
+    unur_urng_sample_array(lat->srng,lat->shift,lat->dim);
+  _unur_urng_lattice_setpoint(lat,lat->start);
+} /* end of _unur_urng_lattice_nextsub() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_lattice_resetsub( struct unur_urng_lattice *lat )
+     /*----------------------------------------------------------------------*/
+     /* Reset current substream: jump to first point of substream.           */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   lat ... pointer to URNG object                                     */
+     /*----------------------------------------------------------------------*/
+{
+  _unur_urng_lattice_setpoint(lat,lat->start);
+} /* end of _unur_urng_lattice_resetsub() */
+
+/*---------------------------------------------------------------------------*/
+
+UNUR_URNG *
+unur_urng_lattice_new( unsigned int dim, unsigned long npoints, const unsigned long *genvec )
+     /*----------------------------------------------------------------------*/
+     /* get new URNG object for rank-1 lattice rule                          */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   dim     ... dimension of point sets                                */
+     /*   npoints ... number of points                                       */
+     /*   genvec  ... generating vector (or NULL)                            */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_lattice *lat;
+  UNUR_URNG *urng;
+  unsigned j;
+
+  /* check argument */
+  if (dim == 0u) {
+    _unur_error("URNG",UNUR_ERR_GENERIC,"Cannot create lattice object for dimension 0");
+    return NULL;
+  }
+  if (npoints == 0UL || npoints > LATTICE_MAXPOINTS) {
+    _unur_error("URNG",UNUR_ERR_GENERIC,"Cannot create lattice object: number of points 0 or too large");
+    return NULL;
+  }
+  if (genvec) {
+    for (j=0; j<dim; j++)
+      if (_unur_urng_lattice_gcd(genvec[j] % npoints, npoints) != 1UL) {
+	_unur_error("URNG",UNUR_ERR_GENERIC,"generating vector not relatively prime to number of points");
+	return NULL;
+      }
+  }
+
+  /* make structure to store generator object */
+  lat = _unur_xmalloc( sizeof(struct unur_urng_lattice) );
+  lat->z = _unur_xmalloc( dim * sizeof(unsigned long) );
+  lat->x = _unur_xmalloc( dim * sizeof(unsigned long) );
+  lat->shift = _unur_xmalloc( dim * sizeof(double) );
+  lat->N = npoints;
+  lat->invN = 1./npoints;
+  lat->srng = NULL;
+  lat->dim = dim;
+  lat->start = 0UL;
+  for (j=0; j<dim; j++)
+    lat->shift[j] = 0.;
+
+  /* generating vector */
+  if (genvec)
+    for (j=0; j<dim; j++)
+      lat->z[j] = genvec[j] % npoints;
+  else
+    _unur_urng_lattice_korobov(lat);
+
+  /* first point */
+  _unur_urng_lattice_setpoint(lat,0UL);
+
+  /* make UNURAN_URNG object */
+  urng = unur_urng_new ( (double(*)(void*)) _unur_urng_lattice_sample, lat );
+  unur_urng_set_sample_array (urng, (unsigned int(*)(void*,double*,int)) _unur_urng_lattice_sample_array);
+  unur_urng_set_delete (urng, (void(*)(void*)) _unur_urng_lattice_free);
+  unur_urng_set_reset (urng, (void(*)(void*)) _unur_urng_lattice_reset);
+  unur_urng_set_sync (urng, (void(*)(void*)) _unur_urng_lattice_nextpoint);
+  unur_urng_set_nextsub (urng, (void(*)(void*)) _unur_urng_lattice_nextsub);
+  unur_urng_set_resetsub (urng, (void(*)(void*)) _unur_urng_lattice_resetsub);
+
+  return urng;
+} /* end of unur_urng_lattice_new() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_urng_lattice_randomize( UNUR_URNG *urng, UNUR_URNG *srng )
+     /*----------------------------------------------------------------------*/
+     /* randomize lattice by random shift                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   urng ... pointer to URNG object for lattice points                 */
+     /*   srng ... generator for random shifts (or NULL)                     */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_lattice *lat;
+  unsigned j;
+
+  /* check argument */
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  if (urng->sampleunif != (double(*)(void*)) _unur_urng_lattice_sample) {
+    _unur_error("URNG",UNUR_ERR_URNG,"not a lattice generator");
+    return UNUR_ERR_URNG;
+  }
+
+  lat = urng->state;
+  lat->srng = srng;
+
+  if (srng) {
+    COOKIE_CHECK(srng,CK_URNG,UNUR_ERR_COOKIE);
+    unur_urng_sample_array(srng,lat->shift,lat->dim);
+  }
+  else {
+    for (j=0; j<lat->dim; j++)
+      lat->shift[j] = 0.;
+  }
+
+  _unur_urng_lattice_setpoint(lat,lat->start);
+
+  return UNUR_SUCCESS;
+} /* end of unur_urng_lattice_randomize() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_urng_lattice_jump( UNUR_URNG *urng, unsigned long index )
+     /*----------------------------------------------------------------------*/
+     /* jump to point with given index                                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   urng  ... pointer to URNG object for lattice points                */
+     /*   index ... index of point                                           */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_lattice *lat;
+
+  /* check argument */
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  if (urng->sampleunif != (double(*)(void*)) _unur_urng_lattice_sample) {
+    _unur_error("URNG",UNUR_ERR_URNG,"not a lattice generator");
+    return UNUR_ERR_URNG;
+  }
+
+  lat = urng->state;
+  if (index >= lat->N) {
+    _unur_error("URNG",UNUR_ERR_URNG,"index >= number of points");
+    return UNUR_ERR_URNG;
+  }
+
+  lat->start = index;
+  _unur_urng_lattice_setpoint(lat,index);
+
+  return UNUR_SUCCESS;
+} /* end of unur_urng_lattice_jump() */
+
+/*---------------------------------------------------------------------------*/
+#endif   /* #if defined(UNUR_URNG_UNURAN) */
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,148 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: urng_lattice.h                                                    *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *     Function prototypes for built-in generator for rank-1 lattice points  *
+ *                                                                           *
+ *   USAGE:                                                                  *
+ *         only included in unuran.h                                         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2006 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#ifndef URNG_LATTICE_H_SEEN
+#define URNG_LATTICE_H_SEEN
+/*---------------------------------------------------------------------------*/
+
+/*
+   =NODE  URNG-LATTICE  Built-in generator for rank-1 lattice points
+
+   =UP URNG [70]
+
+   =DESCRIPTION
+      Generator for the points of a rank-1 lattice rule
+      @unurmath{x_k = \{ k\, z / N + \Delta \},\; k=0,\ldots,N-1,}
+      with generating vector @i{z}, number of points @i{N}, and
+      shift vector @unurmath{\Delta.}
+      (@unurmath{\{\cdot\}} denotes the fractional part.)
+      It does not require any external library.
+
+      The generating vector can be given by the user. Otherwise a
+      Korobov vector @unurmath{z = (1, a, a^2, \ldots, a^{d-1}) mod N}
+      is computed where @i{a} is (approximately) chosen such that
+      the weighted @unurmath{P_2} criterion with weights
+      @unurmath{1/j^2} for coordinate @i{j} becomes minimal.
+      Notice that the search for the optimal @i{a} is only done
+      for a limited number of candidates when @i{N} or the dimension
+      is large.
+
+      The generator can jump directly to the point with a given
+      index (see unur_urng_lattice_jump()). Thus the point set can be
+      partitioned into blocks that are processed in different threads
+      or on different nodes. After the last point the generator
+      starts again with the first point.
+
+      Notice that the first point of the (unshifted) lattice is the
+      origin. Thus it should be randomized by means of
+      unur_urng_lattice_randomize() or the first point should be
+      skipped (see unur_urng_lattice_jump()) when it is used with
+      inversion methods for distributions with unbounded domains.
+
+   =HOWTOUSE
+      Create a URNG object by means of unur_urng_lattice_new().
+      For randomized quasi-Monte Carlo call
+      unur_urng_lattice_randomize().
+
+      The following routines are supported for URNG objects of this
+      type:
+
+      @itemize @minus
+      @item unur_urng_sample()
+      @item unur_urng_sample_array()
+      @item unur_urng_reset()
+      @item unur_urng_sync()
+      @item unur_urng_nextsub()
+      @item unur_urng_resetsub()
+      @item unur_urng_free()
+      @end itemize
+
+      unur_urng_sync() is used to jump to the first coordinate of
+      the next point generated by the generator.
+
+      unur_urng_reset() jumps to the first point of the lattice.
+      unur_urng_resetsub() jumps to the first point of the current
+      substream, i.e., to the point that has been set by the last
+      call to unur_urng_lattice_jump().
+      unur_urng_nextsub() additionally draws a new random shift
+      (if the lattice is randomized) such that each substream is an
+      independent replication of the randomly shifted lattice.
+
+   =END
+
+*/
+
+/*---------------------------------------------------------------------------*/
+
+/* =ROUTINES */
+
+/*---------------------------------------------------------------------------*/
+
+UNUR_URNG *unur_urng_lattice_new( unsigned int dim, unsigned long npoints, const unsigned long *genvec );
+/*
+   Make object for generating the points of a rank-1 lattice rule
+   with @var{npoints} points in dimension @var{dim}.
+   @var{genvec} is the generating vector of length @var{dim}.
+   Its entries must be relatively prime to @var{npoints}.
+   If @var{genvec} is NULL then a Korobov vector is computed.
+   @var{npoints} must not exceed @unurmath{2^{31}.}
+*/
+
+int unur_urng_lattice_randomize( UNUR_URNG *urng, UNUR_URNG *srng );
+/*
+   Randomize the lattice by a random shift (modulo 1) that is drawn
+   from the uniform random number generator @var{srng}.
+   If @var{srng} is NULL the shift is removed.
+   The generator then jumps to the first point of the current
+   substream.
+
+   @emph{Notice:} Only a pointer to @var{srng} is stored in
+   @var{urng}. It is used again by unur_urng_nextsub().
+*/
+
+int unur_urng_lattice_jump( UNUR_URNG *urng, unsigned long index );
+/*
+   Jump to the point with the given @var{index} (starting with 0)
+   which then also becomes the first point of the current substream.
+   The computational costs are independent of @var{index}.
+*/
+
+/* =END */
+
+/*---------------------------------------------------------------------------*/
+#endif  /* URNG_LATTICE_H_SEEN */
+/*---------------------------------------------------------------------------*/
@@ -78,6 +78,11 @@ static int _unur_urng_randomshift_sample_array( struct unur_urng_randomshift *rs
 /* if dim is less than the dimension of the generated points.                */
 /*---------------------------------------------------------------------------*/
 
+static void _unur_urng_randomshift_apply( const double *shift, double *X, int dim );
+/*---------------------------------------------------------------------------*/
+/* Add shift vector to point X (mod 1).                                      */
+/*---------------------------------------------------------------------------*/
+
 static void _unur_urng_randomshift_free( struct unur_urng_randomshift *rs );
 /*---------------------------------------------------------------------------*/
 /* Free generator object.                                                    */
@@ -111,7 +116,6 @@ _unur_urng_randomshift_sample( struct unur_urng_randomshift *rs )
      /*   return UNUR_INFINITY                                               */
      /*----------------------------------------------------------------------*/
 {
-  int i;
   int n = rs->n;
   double *X = rs->X;
 
@@ -119,11 +123,7 @@ _unur_urng_randomshift_sample( struct unur_urng_randomshift *rs )
     /* first coordinate --> get new point */
     unur_urng_sample_array(rs->qrng,X,rs->dim);
     /* make shift */
-    for (i=0; i<rs->dim; i++) {
-      X[i] += rs->shift[i];
-      if (X[i] >= 1.) X[i] -= 1.;
-      if (X[i] < 0.) X[i] += 1.;
-    }
+    _unur_urng_randomshift_apply(rs->shift,X,rs->dim);
   }
 
   /* increment counter for coordinate */
@@ -155,8 +155,6 @@ _unur_urng_randomshift_sample_array( struct unur_urng_randomshift *rs, double *X
      /*   return 0                                                           */
      /*----------------------------------------------------------------------*/
 {
-  int i;
-
   if (dim > rs->dim) dim = rs->dim;
 
   if (dim == rs->dim) {
@@ -168,17 +166,39 @@ _unur_urng_randomshift_sample_array( struct unur_urng_randomshift *rs, double *X
   }
 
   /* make shift */
-  for (i=0; i<dim; i++) {
-    X[i] += rs->shift[i];
-    if (X[i] >= 1.) X[i] -= 1.;
-    if (X[i] < 0.) X[i] += 1.;
-  }
+  _unur_urng_randomshift_apply(rs->shift,X,dim);
 
   return dim;
 } /* end of _unur_urng_randomshift_sample_array() */
 
 /*---------------------------------------------------------------------------*/
 
+void
+_unur_urng_randomshift_apply( const double *shift, double *X, int dim )
+     /*----------------------------------------------------------------------*/
+     /* Add shift vector to point X (mod 1).                                 */
+     /* Both the coordinates of X and the shift are in [0,1). So the sum is  */
+     /* in [0,2) and we only have to subtract 1 if necessary.                */
+     /* The loop does not contain branches and thus can be vectorized by     */
+     /* the compiler.                                                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   shift ... shift vector                                             */
+     /*   X     ... pointer to array of length dim                           */
+     /*   dim   ... number of entries in X                                   */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  double x;
+
+  for (i=0; i<dim; i++) {
+    x = X[i] + shift[i];
+    X[i] = (x >= 1.) ? x - 1. : x;
+  }
+} /* end of _unur_urng_randomshift_apply() */
+
+/*---------------------------------------------------------------------------*/
+
 void
 _unur_urng_randomshift_free( struct unur_urng_randomshift *rs )
      /*----------------------------------------------------------------------*/
@@ -286,6 +306,81 @@ unur_urng_randomshift_nextshift( UNUR_URNG *urng )
   return UNUR_SUCCESS;
 } /* end of unur_urng_randomshift_nextshift() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+unur_urng_randomshift_sample_block( UNUR_URNG *urng, double *X, int npoints, int layout )
+     /*----------------------------------------------------------------------*/
+     /* Sample block of npoints shifted points and store in X.               */
+     /* Each point has dimension 'dim' of the generator object.              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   urng    ... pointer to URNG object                                 */
+     /*   X       ... pointer to array of length npoints * dim               */
+     /*   npoints ... number of points                                       */
+     /*   layout  ... UNUR_RANDOMSHIFT_ROWMAJOR: point i is stored in        */
+     /*                  X[i*dim], ..., X[i*dim+dim-1]                       */
+     /*               UNUR_RANDOMSHIFT_COLMAJOR: coordinate j is stored in   */
+     /*                  X[j*npoints], ..., X[j*npoints+npoints-1]           */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_randomshift *rs;
+  const double *shift;
+  double *Xrow, x;
+  int i, j, dim;
+  size_t offset;   /* (npoints*dim may exceed the range of int) */
+
+  /* check argument */
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  _unur_check_NULL( "URNG", X, UNUR_ERR_NULL );
+  if (urng->sampleunif != (double(*)(void*)) _unur_urng_randomshift_sample) {
+    _unur_error("URNG",UNUR_ERR_URNG,"not a RANDOMSHIFT generator");
+    return UNUR_ERR_URNG;
+  }
+  if (layout != UNUR_RANDOMSHIFT_ROWMAJOR && layout != UNUR_RANDOMSHIFT_COLMAJOR) {
+    _unur_error("URNG",UNUR_ERR_URNG,"unknown layout");
+    return UNUR_ERR_URNG;
+  }
+  if (npoints <= 0) return UNUR_SUCCESS;
+
+  rs = urng->state;
+  dim = rs->dim;
+  shift = rs->shift;
+
+  /* a block always starts with the first coordinate of a new point */
+  rs->n = 0;
+
+  if (layout == UNUR_RANDOMSHIFT_ROWMAJOR) {
+    /* store unshifted points first */
+    for (i=0, offset=0; i<npoints; i++, offset+=dim)
+      unur_urng_sample_array(rs->qrng, X+offset, dim);
+    /* then make shift for the whole block */
+    for (i=0, offset=0; i<npoints; i++, offset+=dim) {
+      Xrow = X+offset;
+      for (j=0; j<dim; j++) {
+	x = Xrow[j] + shift[j];
+	Xrow[j] = (x >= 1.) ? x - 1. : x;
+      }
+    }
+  }
+
+  else { /* layout == UNUR_RANDOMSHIFT_COLMAJOR */
+    for (i=0; i<npoints; i++) {
+      unur_urng_sample_array(rs->qrng, rs->X, dim);
+      for (j=0, offset=i; j<dim; j++, offset+=npoints) {
+	x = rs->X[j] + shift[j];
+	X[offset] = (x >= 1.) ? x - 1. : x;
+      }
+    }
+  }
+
+  return UNUR_SUCCESS;
+} /* end of unur_urng_randomshift_sample_block() */
+
 /*---------------------------------------------------------------------------*/
 #endif   /* #if defined(UNUR_URNG_UNURAN) */
 /*---------------------------------------------------------------------------*/
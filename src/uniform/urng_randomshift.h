@@ -79,6 +79,7 @@
       @item unur_urng_reset() 
       @item unur_urng_sync() 
       @item unur_urng_randomshift_nextshift()
+      @item unur_urng_randomshift_sample_block()
       @item unur_urng_free()
       @end itemize
 
@@ -88,6 +89,13 @@
       unur_urng_randomshift_nextshift() allows to replace the shift
       vector by another randomly chosen shift vector.
 
+      unur_urng_randomshift_sample_block() generates a whole block of
+      shifted points with a single call. The shift is then applied to
+      the entire block at once. The column-major layout stores each
+      coordinate in a contiguous array which can directly be
+      transformed into non-uniform random variates by inversion
+      (e.g., by means of unur_quantile()).
+
       @emph{Important:} unur_urng_sync() is only available if it is
       if it is implemented for the underlying point set generator.
 
@@ -122,6 +130,24 @@ int unur_urng_randomshift_nextshift( UNUR_URNG *urng );
    underlying point generator @var{qrng} is reset.
 */
 
+/* layout of blocks of points */
+#define UNUR_RANDOMSHIFT_ROWMAJOR  (0)   /* points are stored consecutively  */
+#define UNUR_RANDOMSHIFT_COLMAJOR  (1)   /* coordinates are stored consecutively */
+
+int unur_urng_randomshift_sample_block( UNUR_URNG *urng, double *X, int npoints, int layout );
+/* 
+   Generate a block of @var{npoints} shifted points and store them in
+   the array @var{X} which must have length @var{npoints} times the
+   dimension @i{dim} of the point sets.
+   If @var{layout} is @code{UNUR_RANDOMSHIFT_ROWMAJOR} then the
+   coordinates of point @i{i} are stored in
+   @code{X[i*dim]}, @dots{}, @code{X[i*dim+dim-1]}.
+   If @var{layout} is @code{UNUR_RANDOMSHIFT_COLMAJOR} then
+   coordinate @i{j} of all points is stored in
+   @code{X[j*npoints]}, @dots{}, @code{X[j*npoints+npoints-1]}.
+   The block starts with the first coordinate of a new point.
+*/
+
 /*
    =END
 */
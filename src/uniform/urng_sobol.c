@@ -0,0 +1,575 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: urng_sobol.c                                                      *
+ *                                                                           *
+ *   routines to get new URNG object for built-in generator of Sobol'        *
+ *   points with skip-ahead and scrambling.                                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   References:                                                             *
+ *                                                                           *
+ *   [1] Antonov, I.A. and Saleev, V.M. (1979),                              *
+ *       An economic method of computing LP_tau-sequences.                   *
+ *       USSR Comput. Math. Math. Phys. 19, 252-256.                         *
+ *                                                                           *
+ *   [2] Joe, S. and Kuo, F.Y. (2008),                                       *
+ *       Constructing Sobol sequences with better two-dimensional            *
+ *       projections. SIAM J. Sci. Comput. 30, 2635-2654.                    *
+ *                                                                           *
+ *   [3] Owen, A.B. (1995),                                                  *
+ *       Randomly permuted (t,m,s)-nets and (t,s)-sequences.                 *
+ *       In: Monte Carlo and Quasi-Monte Carlo Methods in Scientific         *
+ *       Computing, Lecture Notes in Statistics 106, 299-317.                *
+ *                                                                           *
+ *   [4] Burley, B. (2020),                                                  *
+ *       Practical hash-based Owen scrambling.                               *
+ *       J. Computer Graphics Techniques 9(4), 1-20.                         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2006 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#include <unur_source.h>
+/*---------------------------------------------------------------------------*/
+#if defined(UNUR_URNG_UNURAN)
+/*---------------------------------------------------------------------------*/
+#include <urng/urng.h>
+#include "urng_sobol.h"
+#include "urng_sobol_table.ch"
+/*---------------------------------------------------------------------------*/
+
+#define SOBOL_BITS  (32)               /* number of bits of resolution       */
+#define SOBOL_MASK  (0xffffffffUL)     /* mask for 32 bits                   */
+#define SOBOL_SCALE (2.3283064365386963e-10)   /* 2^(-32)                   */
+
+/* structure for storing generator */
+struct unur_urng_sobol {
+  unsigned long *V;      /* direction numbers (dim x SOBOL_BITS)             */
+  unsigned long *x;      /* current point (integer representation)           */
+  unsigned long *seed;   /* seeds for randomization                          */
+  unsigned long n;       /* index of current point                           */
+  unsigned long start;   /* index of first point of current substream        */
+  UNUR_URNG *srng;       /* generator for randomization                      */
+  int scramble;          /* type of randomization                            */
+  unsigned dim;          /* dimension of points                              */
+  unsigned coord;        /* current coordinate                               */
+};
+
+/*---------------------------------------------------------------------------*/
+
+static double _unur_urng_sobol_sample( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Sample next coordinate of random point.                                   */
+/* Skip to first coordinate of next point after last coordinate.             */
+/*---------------------------------------------------------------------------*/
+
+static int _unur_urng_sobol_sample_array( struct unur_urng_sobol *sobol, double *X, int dim );
+/*---------------------------------------------------------------------------*/
+/* Sample random point and store in X. use only the first dim coordinates    */
+/* if dim is less than the dimension of the generated points.                */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_free( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Free generator object.                                                    */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_reset( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Reset generator object.                                                   */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_nextpoint( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Skip to first coordinate of next point.                                   */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_nextsub( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Skip to next substream (new randomization).                               */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_resetsub( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Reset current substream.                                                  */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_setpoint( struct unur_urng_sobol *sobol, unsigned long index );
+/*---------------------------------------------------------------------------*/
+/* Compute point with given index (Gray code).                               */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_advance( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Compute next point.                                                       */
+/*---------------------------------------------------------------------------*/
+
+static void _unur_urng_sobol_seeds( struct unur_urng_sobol *sobol );
+/*---------------------------------------------------------------------------*/
+/* Draw new seeds for randomization.                                         */
+/*---------------------------------------------------------------------------*/
+
+static double _unur_urng_sobol_coord( const struct unur_urng_sobol *sobol, unsigned j );
+/*---------------------------------------------------------------------------*/
+/* Return (randomized) coordinate j of current point.                        */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_urng_sobol_sample( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Sample next coordinate of random point.                              */
+     /* Skip to first coordinate of next point after last coordinate.        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   next coordinate                                                    */
+     /*----------------------------------------------------------------------*/
+{
+  double u = _unur_urng_sobol_coord(sobol,sobol->coord);
+
+  if (++(sobol->coord) == sobol->dim) {
+    /* last coordinate --> compute next point */
+    _unur_urng_sobol_advance(sobol);
+    sobol->coord = 0u;
+  }
+
+  return u;
+} /* end of _unur_urng_sobol_sample() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_urng_sobol_sample_array( struct unur_urng_sobol *sobol, double *X, int dim )
+     /*----------------------------------------------------------------------*/
+     /* Sample random point and store in X. use only the first dim coordin.  */
+     /* if dim is less than the dimension of the generated points.           */
+     /* Return number of entries filled into array X.                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*   X     ... pointer to array of length dim                           */
+     /*   dim   ... (maximal) number of entries in X to be set               */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   number of uniform random numbers filled into array                 */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned j;
+
+  if (dim <= 0) return 0;
+  if ((unsigned)dim > sobol->dim) dim = (int) sobol->dim;
+
+  /* we always start with the first coordinate of a new point */
+  _unur_urng_sobol_nextpoint(sobol);
+
+  for (j=0; j<(unsigned)dim; j++)
+    X[j] = _unur_urng_sobol_coord(sobol,j);
+
+  _unur_urng_sobol_advance(sobol);
+
+  return dim;
+} /* end of _unur_urng_sobol_sample_array() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_unur_urng_sobol_coord( const struct unur_urng_sobol *sobol, unsigned j )
+     /*----------------------------------------------------------------------*/
+     /* Return (randomized) coordinate j of current point.                   */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*   j     ... coordinate                                               */
+     /*                                                                      */
+     /* comment:                                                             */
+     /*   The coordinate y/2^32 is shifted by half the resolution, i.e., we  */
+     /*   return the midpoint (y+1/2)/2^32 of the elementary interval. Thus  */
+     /*   the result is in the open interval (0,1), in particular for the    */
+     /*   first point of the sequence (y=0) which would result in infinite  */
+     /*   variates when used for inversion. Each point remains in its       */
+     /*   elementary interval, i.e., the stratification is not changed.     */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned long y = sobol->x[j];
+
+  switch (sobol->scramble) {
+  case UNUR_SOBOL_SHIFT:
+    y ^= sobol->seed[j];
+    break;
+
+  case UNUR_SOBOL_OWEN:
+    /* nested uniform scrambling: reverse bits, apply Laine-Karras */
+    /* permutation with improved constants, and reverse bits [4].  */
+    y = ((y >> 1) & 0x55555555UL) | ((y & 0x55555555UL) << 1);
+    y = ((y >> 2) & 0x33333333UL) | ((y & 0x33333333UL) << 2);
+    y = ((y >> 4) & 0x0f0f0f0fUL) | ((y & 0x0f0f0f0fUL) << 4);
+    y = ((y >> 8) & 0x00ff00ffUL) | ((y & 0x00ff00ffUL) << 8);
+    y = ((y >> 16) | (y << 16)) & SOBOL_MASK;
+
+    y = (y + sobol->seed[j]) & SOBOL_MASK;
+    y ^= (y * 0x6c50b47cUL) & SOBOL_MASK;
+    y ^= (y * 0xb82f1e52UL) & SOBOL_MASK;
+    y ^= (y * 0xc7afe638UL) & SOBOL_MASK;
+    y ^= (y * 0x8d22f6e6UL) & SOBOL_MASK;
+
+    y = ((y >> 1) & 0x55555555UL) | ((y & 0x55555555UL) << 1);
+    y = ((y >> 2) & 0x33333333UL) | ((y & 0x33333333UL) << 2);
+    y = ((y >> 4) & 0x0f0f0f0fUL) | ((y & 0x0f0f0f0fUL) << 4);
+    y = ((y >> 8) & 0x00ff00ffUL) | ((y & 0x00ff00ffUL) << 8);
+    y = ((y >> 16) | (y << 16)) & SOBOL_MASK;
+    break;
+
+  case UNUR_SOBOL_NOSCRAMBLE:
+  default:
+    break;
+  }
+
+  return ((y + 0.5) * SOBOL_SCALE);
+} /* end of _unur_urng_sobol_coord() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_advance( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Compute next point (Gray code order [1]):                            */
+     /*   x_{n+1} = x_n XOR V_c  where c is the position of the lowest       */
+     /*   zero bit of n.                                                     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned long n = sobol->n;
+  unsigned c, j;
+
+  for (c=0; c<SOBOL_BITS && (n & 1UL); c++)
+    n >>= 1;
+
+  if (c >= SOBOL_BITS) {
+    /* all 2^32 points used --> start again with first point */
+    _unur_warning("URNG",UNUR_ERR_GENERIC,"Sobol' sequence exhausted: restart");
+    _unur_urng_sobol_setpoint(sobol,0UL);
+    return;
+  }
+
+  for (j=0; j<sobol->dim; j++)
+    sobol->x[j] ^= sobol->V[j*SOBOL_BITS + c];
+
+  sobol->n = (sobol->n + 1UL) & SOBOL_MASK;
+} /* end of _unur_urng_sobol_advance() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_setpoint( struct unur_urng_sobol *sobol, unsigned long index )
+     /*----------------------------------------------------------------------*/
+     /* Compute point with given index:                                      */
+     /*   x_n = XOR of all V_c where bit c of Gray code of n is set.         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*   index ... index of point                                           */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned long gray;
+  unsigned c, j;
+
+  index &= SOBOL_MASK;
+  gray = index ^ (index >> 1);
+
+  for (j=0; j<sobol->dim; j++) {
+    sobol->x[j] = 0UL;
+    for (c=0; c<SOBOL_BITS; c++)
+      if ((gray >> c) & 1UL)
+	sobol->x[j] ^= sobol->V[j*SOBOL_BITS + c];
+  }
+
+  sobol->n = index;
+  sobol->coord = 0u;
+} /* end of _unur_urng_sobol_setpoint() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_seeds( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Draw new seeds for randomization.                                    */
+     /* (We use 16 bits of each uniform random number.)                      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  unsigned long hi, lo;
+  unsigned j;
+
+  for (j=0; j<sobol->dim; j++) {
+    hi = (unsigned long) (65536. * unur_urng_sample(sobol->srng)) & 0xffffUL;
+    lo = (unsigned long) (65536. * unur_urng_sample(sobol->srng)) & 0xffffUL;
+    sobol->seed[j] = (hi << 16) | lo;
+  }
+} /* end of _unur_urng_sobol_seeds() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_free( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Free URNG object.                                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  if (sobol) {
+    free( sobol->V );
+    free( sobol->x );
+    free( sobol->seed );
+    free( sobol );
+  }
+} /* end of _unur_urng_sobol_free() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_reset( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Reset URNG object: jump to first point of sequence.                  */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  sobol->start = 0UL;
+  _unur_urng_sobol_setpoint(sobol,0UL);
+} /* end of _unur_urng_sobol_reset() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_nextpoint( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Skip to first coordinate of next point.                              */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  if (sobol->coord > 0u) {
+    _unur_urng_sobol_advance(sobol);
+    sobol->coord = 0u;
+  }
+} /* end of _unur_urng_sobol_nextpoint() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_nextsub( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Skip to next substream, i.e., draw new seeds for randomization and   */
+     /* jump to first point of substream.                                    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  if (sobol->srng && sobol->scramble != UNUR_SOBOL_NOSCRAMBLE)
+    _unur_urng_sobol_seeds(sobol);
+  _unur_urng_sobol_setpoint(sobol,sobol->start);
+} /* end of _unur_urng_sobol_nextsub() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_urng_sobol_resetsub( struct unur_urng_sobol *sobol )
+     /*----------------------------------------------------------------------*/
+     /* Reset current substream: jump to first point of substream.           */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   sobol ... pointer to URNG object                                   */
+     /*----------------------------------------------------------------------*/
+{
+  _unur_urng_sobol_setpoint(sobol,sobol->start);
+} /* end of _unur_urng_sobol_resetsub() */
+
+/*---------------------------------------------------------------------------*/
+
+UNUR_URNG *
+unur_urng_sobol_new( unsigned int dim )
+     /*----------------------------------------------------------------------*/
+     /* get new URNG object for Sobol' points                                */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   dim ... dimension of point sets                                    */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_sobol *sobol;
+  UNUR_URNG *urng;
+  unsigned long *V, poly;
+  unsigned j, k, l, s;
+
+  /* check argument */
+  if (dim == 0u || dim > SOBOL_MAXDIM) {
+    _unur_error("URNG",UNUR_ERR_GENERIC,"Cannot create Sobol' object: dimension 0 or too large");
+    return NULL;
+  }
+
+  /* make structure to store generator object */
+  sobol = _unur_xmalloc( sizeof(struct unur_urng_sobol) );
+  sobol->V = _unur_xmalloc( dim * SOBOL_BITS * sizeof(unsigned long) );
+  sobol->x = _unur_xmalloc( dim * sizeof(unsigned long) );
+  sobol->seed = _unur_xmalloc( dim * sizeof(unsigned long) );
+  sobol->srng = NULL;
+  sobol->scramble = UNUR_SOBOL_NOSCRAMBLE;
+  sobol->dim = dim;
+  sobol->start = 0UL;
+
+  /* compute direction numbers [2] */
+  for (j=0; j<dim; j++) {
+    V = sobol->V + j*SOBOL_BITS;
+    sobol->seed[j] = 0UL;
+
+    if (j==0) {
+      /* van der Corput sequence */
+      for (k=0; k<SOBOL_BITS; k++)
+	V[k] = 1UL << (SOBOL_BITS-1-k);
+      continue;
+    }
+
+    /* degree of primitive polynomial */
+    poly = _unur_sobol_table[j].poly;
+    for (s=0; (poly >> (s+1)) != 0UL; s++) ;
+
+    /* initial direction numbers */
+    for (k=0; k<s; k++)
+      V[k] = (unsigned long) _unur_sobol_table[j].m[k] << (SOBOL_BITS-1-k);
+
+    /* recurrence */
+    for (k=s; k<SOBOL_BITS; k++) {
+      V[k] = V[k-s] ^ (V[k-s] >> s);
+      for (l=1; l<s; l++)
+	if ((poly >> (s-l)) & 1UL)
+	  V[k] ^= V[k-l];
+    }
+  }
+
+  /* first point */
+  _unur_urng_sobol_setpoint(sobol,0UL);
+
+  /* make UNURAN_URNG object */
+  urng = unur_urng_new ( (double(*)(void*)) _unur_urng_sobol_sample, sobol );
+  unur_urng_set_sample_array (urng, (unsigned int(*)(void*,double*,int)) _unur_urng_sobol_sample_array);
+  unur_urng_set_delete (urng, (void(*)(void*)) _unur_urng_sobol_free);
+  unur_urng_set_reset (urng, (void(*)(void*)) _unur_urng_sobol_reset);
+  unur_urng_set_sync (urng, (void(*)(void*)) _unur_urng_sobol_nextpoint);
+  unur_urng_set_nextsub (urng, (void(*)(void*)) _unur_urng_sobol_nextsub);
+  unur_urng_set_resetsub (urng, (void(*)(void*)) _unur_urng_sobol_resetsub);
+
+  return urng;
+} /* end of unur_urng_sobol_new() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_urng_sobol_scramble( UNUR_URNG *urng, UNUR_URNG *srng, int type )
+     /*----------------------------------------------------------------------*/
+     /* randomize Sobol' point set                                           */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   urng ... pointer to URNG object for Sobol' points                  */
+     /*   srng ... generator for random seeds                                */
+     /*   type ... type of randomization                                     */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_sobol *sobol;
+
+  /* check argument */
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  if (urng->sampleunif != (double(*)(void*)) _unur_urng_sobol_sample) {
+    _unur_error("URNG",UNUR_ERR_URNG,"not a Sobol' generator");
+    return UNUR_ERR_URNG;
+  }
+  if (type != UNUR_SOBOL_NOSCRAMBLE && type != UNUR_SOBOL_SHIFT && type != UNUR_SOBOL_OWEN) {
+    _unur_error("URNG",UNUR_ERR_URNG,"unknown type of scrambling");
+    return UNUR_ERR_URNG;
+  }
+  if (type != UNUR_SOBOL_NOSCRAMBLE) {
+    _unur_check_NULL( "URNG", srng, UNUR_ERR_NULL );  COOKIE_CHECK(srng,CK_URNG,UNUR_ERR_COOKIE);
+  }
+
+  sobol = urng->state;
+  sobol->srng = srng;
+  sobol->scramble = type;
+
+  if (type != UNUR_SOBOL_NOSCRAMBLE)
+    _unur_urng_sobol_seeds(sobol);
+
+  _unur_urng_sobol_setpoint(sobol,sobol->start);
+
+  return UNUR_SUCCESS;
+} /* end of unur_urng_sobol_scramble() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_urng_sobol_jump( UNUR_URNG *urng, unsigned long index )
+     /*----------------------------------------------------------------------*/
+     /* jump to point with given index                                       */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   urng  ... pointer to URNG object for Sobol' points                 */
+     /*   index ... index of point                                           */
+     /*----------------------------------------------------------------------*/
+{
+  struct unur_urng_sobol *sobol;
+
+  /* check argument */
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  if (urng->sampleunif != (double(*)(void*)) _unur_urng_sobol_sample) {
+    _unur_error("URNG",UNUR_ERR_URNG,"not a Sobol' generator");
+    return UNUR_ERR_URNG;
+  }
+  if (index > SOBOL_MASK) {
+    _unur_error("URNG",UNUR_ERR_URNG,"index >= 2^32");
+    return UNUR_ERR_URNG;
+  }
+
+  sobol = urng->state;
+  sobol->start = index;
+  _unur_urng_sobol_setpoint(sobol,index);
+
+  return UNUR_SUCCESS;
+} /* end of unur_urng_sobol_jump() */
+
+/*---------------------------------------------------------------------------*/
+#endif   /* #if defined(UNUR_URNG_UNURAN) */
+/*---------------------------------------------------------------------------*/
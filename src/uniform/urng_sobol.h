@@ -0,0 +1,149 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: urng_sobol.h                                                      *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *     Function prototypes for built-in generator for Sobol' points          *
+ *                                                                           *
+ *   USAGE:                                                                  *
+ *         only included in unuran.h                                         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2006 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#ifndef URNG_SOBOL_H_SEEN
+#define URNG_SOBOL_H_SEEN
+/*---------------------------------------------------------------------------*/
+
+/*
+   =NODE  URNG-SOBOL  Built-in generator for Sobol' points
+
+   =UP URNG [60]
+
+   =DESCRIPTION
+      Generator for the Sobol' sequence of quasi-random points in
+      dimensions up to 1111 with the direction numbers by
+      S. Joe and F.Y. Kuo (2008). It does not require any external
+      library.
+
+      Points are generated in Gray code order with 32 bit resolution.
+      Thus the sequence consists of @math{2^{32}} points.
+      Each coordinate @unurmath{y / 2^{32}} is shifted to the midpoint
+      @unurmath{(y + 1/2) / 2^{32}} of its elementary interval. Thus all
+      coordinates are in the open interval (0,1). In particular the
+      first point of the (unscrambled) sequence is not the origin
+      (which would result in infinite random variates when used with
+      inversion) but @unurmath{(2^{-33},\ldots,2^{-33}).}
+
+      The generator can jump directly to the point with a given
+      index (see unur_urng_sobol_jump()). Thus the point set can be
+      partitioned into blocks that are processed in different threads
+      or on different nodes.
+
+      The point set can be randomized by a random digital shift or
+      by nested uniform (Owen) scrambling where the latter is
+      implemented by means of the hash based method of
+      B. Burley (2020).
+
+   =HOWTOUSE
+      Create a URNG object by means of unur_urng_sobol_new().
+      For randomized quasi-Monte Carlo call
+      unur_urng_sobol_scramble().
+
+      The following routines are supported for URNG objects of this
+      type:
+
+      @itemize @minus
+      @item unur_urng_sample()
+      @item unur_urng_sample_array()
+      @item unur_urng_reset()
+      @item unur_urng_sync()
+      @item unur_urng_nextsub()
+      @item unur_urng_resetsub()
+      @item unur_urng_free()
+      @end itemize
+
+      unur_urng_sync() is used to jump to the first coordinate of
+      the next point generated by the generator.
+
+      unur_urng_reset() jumps to the first point of the sequence.
+      unur_urng_resetsub() jumps to the first point of the current
+      substream, i.e., to the point that has been set by the last
+      call to unur_urng_sobol_jump().
+      unur_urng_nextsub() additionally draws a new randomization
+      (if the point set is scrambled) such that each substream is an
+      independent replication of the randomized point set.
+
+   =END
+
+*/
+
+/*---------------------------------------------------------------------------*/
+
+/* =ROUTINES */
+
+/*---------------------------------------------------------------------------*/
+
+/* types of scrambling */
+#define UNUR_SOBOL_NOSCRAMBLE   (0)  /* no randomization                     */
+#define UNUR_SOBOL_SHIFT        (1)  /* random digital shift                 */
+#define UNUR_SOBOL_OWEN         (2)  /* nested uniform (Owen) scrambling     */
+
+/*---------------------------------------------------------------------------*/
+
+UNUR_URNG *unur_urng_sobol_new( unsigned int dim );
+/*
+   Make object for generating Sobol' points of dimension @var{dim}.
+   @var{dim} must not exceed 1111.
+*/
+
+int unur_urng_sobol_scramble( UNUR_URNG *urng, UNUR_URNG *srng, int type );
+/*
+   Randomize the Sobol' point set. @var{type} is one of
+   @code{UNUR_SOBOL_NOSCRAMBLE}, @code{UNUR_SOBOL_SHIFT} (random
+   digital shift), and @code{UNUR_SOBOL_OWEN} (nested uniform
+   scrambling). The random seeds for the randomization are drawn
+   from the uniform random number generator @var{srng}.
+   The generator then jumps to the first point of the current
+   substream.
+
+   @emph{Notice:} Only a pointer to @var{srng} is stored in
+   @var{urng}. It is used again by unur_urng_nextsub().
+*/
+
+int unur_urng_sobol_jump( UNUR_URNG *urng, unsigned long index );
+/*
+   Jump to the point with the given @var{index} (starting with 0)
+   which then also becomes the first point of the current substream.
+   The computational costs are independent of @var{index}.
+*/
+
+/* =END */
+
+/*---------------------------------------------------------------------------*/
+#endif  /* URNG_SOBOL_H_SEEN */
+/*---------------------------------------------------------------------------*/
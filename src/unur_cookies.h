@@ -162,6 +162,9 @@
 
 #define CK_SPECIALGEN_CONT 0xd00001u
 
+/* pools of generator objects */
+#define CK_GEN_POOL      0xc0000001u
+
 /* URNG (uniform random number generator objects) */
 #define CK_URNG          0xb0000001u
 
@@ -118,6 +118,7 @@
 #include <utils/string_source.h>
 
 /* allocate memory */
+#include <utils/umalloc.h>
 #include <utils/umalloc_source.h>
 
 /* simple lists */
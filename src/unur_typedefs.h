@@ -47,6 +47,9 @@ typedef struct unur_par   UNUR_PAR;
 struct unur_gen;                         /* generator object                 */
 typedef struct unur_gen   UNUR_GEN;
 
+struct unur_gen_pool;                    /* pool of generator objects        */
+typedef struct unur_gen_pool UNUR_GEN_POOL;
+
 struct unur_urng;                        /* uniform random number generator  */
 typedef struct unur_urng  UNUR_URNG;
 /* comment out the following definition when type 'UNUR_URNG' is changed !!  */
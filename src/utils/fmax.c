@@ -275,6 +275,149 @@ _unur_util_find_max( struct unur_funct_generic fs, /* function structure */
 #undef MAX_SRCH
 } /* end of _unur_util_find_max() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_util_bracket_max( struct unur_funct_generic fs, /* function structure */ 
+			double interval_min,   /* lower bound of interval   */
+			double interval_max,   /* upper bound of interval   */
+			double guess_max,      /* initial guess for maximum */
+			double *x,             /* bracket (3 points)        */
+			double *fx             /* function values at bracket */
+			)
+     /*----------------------------------------------------------------------*/
+     /* find bracket x[0] < x[1] < x[2] with fx[0] <= fx[1] >= fx[2] for     */
+     /* the maximum of a univariate function.                                */
+     /*                                                                      */
+     /* The function is evaluated at batches of candidate points             */
+     /* guess_max +/- unit*2^k, k=0,1,2,... on either side of guess_max.     */
+     /* The candidate points of a batch do not depend on each other.         */
+     /* The first batch contains guess_max and the points with k=0,1,2 on    */
+     /* both sides. If the largest function value is found at an outermost   */
+     /* point, then the next batch of points is added on this side.          */
+     /* The candidates coincide with the points used in the search in        */
+     /* _unur_util_find_max(). Thus its fallback can reuse cached values.    */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   fs           ... function structure                                */
+     /*   interval_min ... left boundary of function definition interval     */
+     /*   interval_max ... right boundary of function definition interval    */
+     /*   guess_max    ... initial guess for max position                    */
+     /*   x            ... array of size 3 for storing bracket               */
+     /*   fx           ... array of size 3 for storing function values       */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   UNUR_FAILURE ... if no bracket found (e.g. maximum at boundary,    */
+     /*                    function vanishes at all candidates, pole)        */
+     /*----------------------------------------------------------------------*/
+{
+#define BATCH_FIRST (3)     /* points on either side in first batch */
+#define BATCH_NEXT  (4)     /* points in subsequent batches         */
+#define MAX_POINTS  (64)    /* maximal number of candidate points   */
+
+  double xp[MAX_POINTS], fp[MAX_POINTS]; /* candidates (sorted) and values */
+  double xb[2*BATCH_FIRST+1];            /* batch of new candidates        */
+  double fb[2*BATCH_FIRST+1];            /* and their function values      */
+  int n_points = 0;           /* number of evaluated candidates            */
+  int n_batch;                /* number of points in current batch         */
+  int k[2];                   /* next exponent on left and right side      */
+  int done[2];                /* whether boundary is reached on the side   */
+  double center, unit, t;
+  int side, i, j, imax;
+
+  /* point of departure */
+  if (_unur_isfinite(guess_max) && 
+      guess_max > interval_min && guess_max < interval_max)
+    center = guess_max;
+  else if (_unur_isfinite(interval_min) && _unur_isfinite(interval_max))
+    center = interval_min/2. + interval_max/2.;
+  else if (_unur_isfinite(interval_min))
+    center = interval_min + 1.;
+  else if (_unur_isfinite(interval_max))
+    center = interval_max - 1.;
+  else
+    center = 0.;
+
+  /* unit step size */
+  unit = 1.;
+  if (_unur_isfinite(interval_min) && _unur_isfinite(interval_max))
+    unit = _unur_min(1., (interval_max - interval_min) / 64.);
+
+  k[0] = k[1] = 0;
+  done[0] = done[1] = FALSE;
+
+  /* first batch contains guess */
+  xb[0] = center;
+  n_batch = 1;
+  side = -1;     /* both sides */
+
+  while (1) {
+
+    /* add candidates on either side */
+    for (j=0; j<2; j++) {
+      if ( (side>=0 && side!=j) || done[j] ) continue;
+      for (i=0; i < ((side<0) ? BATCH_FIRST : BATCH_NEXT); i++) {
+	t = center + ((j==0) ? -unit : unit) * ldexp(1.,k[j]);
+	++k[j];
+	if ( (j==0 && t <= interval_min) || (j==1 && t >= interval_max) ) {
+	  /* use boundary of interval instead */
+	  t = (j==0) ? interval_min : interval_max;
+	  done[j] = TRUE;
+	  if (!_unur_isfinite(t)) break;
+	}
+	xb[n_batch++] = t;
+	if (done[j]) break;
+      }
+    }
+
+    if (n_batch == 0 || n_points + n_batch > MAX_POINTS)
+      return UNUR_FAILURE;
+
+    /* evaluate function at batch of candidates */
+    for (i=0; i<n_batch; i++)
+      fb[i] = fs.f(xb[i], fs.params);
+
+    /* insert into sorted list of candidates */
+    for (i=0; i<n_batch; i++) {
+      for (j=n_points; j>0 && xp[j-1] > xb[i]; j--) {
+	xp[j] = xp[j-1]; fp[j] = fp[j-1];
+      }
+      xp[j] = xb[i]; fp[j] = fb[i];
+      ++n_points;
+    }
+    n_batch = 0;
+
+    /* candidate with largest function value */
+    imax = 0;
+    for (i=1; i<n_points; i++)
+      if (fp[i] > fp[imax]) imax = i;
+
+    if ( !(fp[imax] > 0.) || !_unur_isfinite(fp[imax]) )
+      /* function vanishes at all candidates or has pole */
+      return UNUR_FAILURE;
+
+    if (imax > 0 && imax < n_points-1) {
+      /* bracket found */
+      for (i=0; i<3; i++) {
+	x[i] = xp[imax-1+i];
+	fx[i] = fp[imax-1+i];
+      }
+      return UNUR_SUCCESS;
+    }
+
+    /* maximum at outermost candidate: continue on this side */
+    side = (imax == 0) ? 0 : 1;
+    if (done[side])
+      /* maximum at boundary of interval */
+      return UNUR_FAILURE;
+  }
+
+#undef BATCH_FIRST
+#undef BATCH_NEXT
+#undef MAX_POINTS
+} /* end of _unur_util_bracket_max() */
+
 /*---------------------------------------------------------------------------*/
 /*                                                                           */
 /* Brent algorithm for maximum-calculation of a continous function           */
@@ -41,6 +41,14 @@ double _unur_util_find_max( struct unur_funct_generic fs,
 			  
 /*---------------------------------------------------------------------------*/
 
+/* find bracket for maximum of a generic function by evaluating batches */
+/* of candidate points                                                   */
+int _unur_util_bracket_max( struct unur_funct_generic fs,
+			    double interval_min, double interval_max,
+			    double max_guess, double *x, double *fx );
+
+/*---------------------------------------------------------------------------*/
+
 /* brent algorithm for maximum-calculation of a continous function */
 double _unur_util_brent(struct unur_funct_generic fs,
                         double a, double b, double c, double tol);
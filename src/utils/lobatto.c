@@ -764,3 +764,18 @@ int _unur_lobatto_size_table (struct unur_lobatto_table *Itable)
 } /* end of _unur_lobatto_size_table() */
 
 /*---------------------------------------------------------------------------*/
+
+size_t _unur_lobatto_memsize (const struct unur_lobatto_table *Itable)
+     /*----------------------------------------------------------------------*/
+     /* number of bytes occupied by table of integral values.                */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   Itable       ... table with integral values                        */
+     /*----------------------------------------------------------------------*/
+{
+  if (Itable == NULL) return 0;
+  return (sizeof(struct unur_lobatto_table) 
+	  + Itable->size * sizeof(struct unur_lobatto_nodes));
+} /* end of _unur_lobatto_memsize() */
+
+/*---------------------------------------------------------------------------*/
@@ -97,3 +97,8 @@ int _unur_lobatto_size_table (struct unur_lobatto_table *Itable);
 /* size of table of integral values.                                         */
 /*---------------------------------------------------------------------------*/
 
+size_t _unur_lobatto_memsize (const struct unur_lobatto_table *Itable);
+/*---------------------------------------------------------------------------*/
+/* number of bytes occupied by table of integral values.                     */
+/*---------------------------------------------------------------------------*/
+
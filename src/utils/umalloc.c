@@ -38,6 +38,18 @@
 #include <R_ext/Error.h>
 #endif
 
+/*---------------------------------------------------------------------------*/
+/* counters for allocated memory (see unur_get_alloc_stats())               */
+
+#ifdef UNUR_ENABLE_ALLOC_STATS
+static unsigned long _unur_alloc_n_calls = 0ul;   /* number of calls        */
+static unsigned long _unur_alloc_n_bytes = 0ul;   /* number of bytes        */
+#  define _unur_alloc_count(size) \
+     do { ++_unur_alloc_n_calls; _unur_alloc_n_bytes += (unsigned long)(size); } while(0)
+#else
+#  define _unur_alloc_count(size)  do {} while(0)
+#endif
+
 /*---------------------------------------------------------------------------*/
 
 void*
@@ -56,6 +68,7 @@ _unur_xmalloc(size_t size)
 
   /* allocate memory */
   ptr = malloc( size );
+  _unur_alloc_count(size);
 
   /* successful ? */
   if (ptr == NULL) {
@@ -91,6 +104,7 @@ _unur_xrealloc(void *ptr, size_t size)
   /* reallocate memory */
   
   new_ptr = realloc( ptr, size );
+  _unur_alloc_count(size);
 
   /* successful ? */
   if (new_ptr == NULL) {
@@ -106,4 +120,248 @@ _unur_xrealloc(void *ptr, size_t size)
 
 } /* end of _unur_xrealloc() */
 
+/*****************************************************************************/
+/**  Memory blocks with reference counter                                   **/
+/*****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/* Each block starts with a header that stores the number of references and  */
+/* the size of the block. The pointer returned to the caller points to the   */
+/* memory right after this header.                                           */
+/* The reference counter is not atomic. Thus objects that share a memory     */
+/* block must not be copied or destroyed concurrently.                       */
+
+union unur_shared_header {
+  struct {
+    int    n_refs;      /* number of references to memory block              */
+    size_t size;        /* size of memory block (without header)             */
+  } h;
+  double align_d;       /* force alignment of data in block                  */
+  void  *align_p;
+};
+
+#define SHARED_HEADER(ptr)  ( ((union unur_shared_header *)(ptr)) - 1 )
+
+/*---------------------------------------------------------------------------*/
+
+void*
+_unur_xmalloc_shared(size_t size)
+     /*----------------------------------------------------------------------*/
+     /* allocate memory block with reference counter                         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   size ... size of allocated block                                   */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   abort program                                                      */
+     /*----------------------------------------------------------------------*/
+{
+  union unur_shared_header *head;
+
+  head = _unur_xmalloc( sizeof(union unur_shared_header) + size );
+  head->h.n_refs = 1;
+  head->h.size = size;
+
+  return (head + 1);
+} /* end of _unur_xmalloc_shared() */
+
+/*---------------------------------------------------------------------------*/
+
+void*
+_unur_xrealloc_shared(void *ptr, size_t size)
+     /*----------------------------------------------------------------------*/
+     /* reallocate memory block with reference counter.                      */
+     /* if the block is shared a new block is allocated.                     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ptr  ... address of memory block previously allocated by           */
+     /*            _unur_xmalloc_shared() (or NULL)                          */
+     /*   size ... size of reallocated block                                 */
+     /*                                                                      */
+     /* error:                                                               */
+     /*   abort program                                                      */
+     /*----------------------------------------------------------------------*/
+{
+  union unur_shared_header *head;
+  void *new_ptr;
+
+  if (ptr == NULL)
+    return _unur_xmalloc_shared(size);
+
+  head = SHARED_HEADER(ptr);
+
+  if (head->h.n_refs > 1) {
+    /* block is shared: make new one */
+    new_ptr = _unur_xmalloc_shared(size);
+    memcpy( new_ptr, ptr, _unur_min(size, head->h.size) );
+    --(head->h.n_refs);
+    return new_ptr;
+  }
+
+  head = _unur_xrealloc( head, sizeof(union unur_shared_header) + size );
+  head->h.size = size;
+  return (head + 1);
+} /* end of _unur_xrealloc_shared() */
+
+/*---------------------------------------------------------------------------*/
+
+void*
+_unur_shared_ref(void *ptr)
+     /*----------------------------------------------------------------------*/
+     /* add reference to memory block                                        */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ptr ... address of memory block (or NULL)                          */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   ptr                                                                */
+     /*----------------------------------------------------------------------*/
+{
+  if (ptr) ++(SHARED_HEADER(ptr)->h.n_refs);
+  return ptr;
+} /* end of _unur_shared_ref() */
+
+/*---------------------------------------------------------------------------*/
+
+void*
+_unur_shared_own(void *ptr, size_t size)
+     /*----------------------------------------------------------------------*/
+     /* get memory block that is not shared and thus can be modified         */
+     /* (copy-on-write).                                                     */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ptr  ... address of memory block (or NULL)                         */
+     /*   size ... size of block when a new one must be allocated            */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   ptr          ... if block is not shared                            */
+     /*   new block    ... otherwise (contains a copy of the old block)      */
+     /*----------------------------------------------------------------------*/
+{
+  union unur_shared_header *head;
+  void *new_ptr;
+
+  if (ptr == NULL)
+    return _unur_xmalloc_shared(size);
+
+  head = SHARED_HEADER(ptr);
+  if (head->h.n_refs == 1)
+    return ptr;
+
+  new_ptr = _unur_xmalloc_shared(head->h.size);
+  memcpy( new_ptr, ptr, head->h.size );
+  --(head->h.n_refs);
+
+  return new_ptr;
+} /* end of _unur_shared_own() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_unur_shared_free(void *ptr)
+     /*----------------------------------------------------------------------*/
+     /* remove reference to memory block.                                    */
+     /* the block is freed when the last reference is removed.               */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ptr ... address of memory block (or NULL)                          */
+     /*----------------------------------------------------------------------*/
+{
+  union unur_shared_header *head;
+
+  if (ptr == NULL) return;
+
+  head = SHARED_HEADER(ptr);
+  if (--(head->h.n_refs) <= 0)
+    free(head);
+} /* end of _unur_shared_free() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_unur_shared_n_refs(const void *ptr)
+     /*----------------------------------------------------------------------*/
+     /* number of references to memory block                                 */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ptr ... address of memory block (or NULL)                          */
+     /*----------------------------------------------------------------------*/
+{
+  return ((ptr) ? SHARED_HEADER(ptr)->h.n_refs : 0);
+} /* end of _unur_shared_n_refs() */
+
+/*---------------------------------------------------------------------------*/
+
+size_t
+_unur_shared_memsize(const void *ptr)
+     /*----------------------------------------------------------------------*/
+     /* size of memory block (including header) divided by number of         */
+     /* references, i.e., the share of each object that uses the block.      */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   ptr ... address of memory block (or NULL)                          */
+     /*----------------------------------------------------------------------*/
+{
+  const union unur_shared_header *head;
+
+  if (ptr == NULL) return 0;
+
+  head = ((const union unur_shared_header *)(ptr)) - 1;
+  return ( (sizeof(union unur_shared_header) + head->h.size) / head->h.n_refs );
+} /* end of _unur_shared_memsize() */
+
+/*---------------------------------------------------------------------------*/
+
+#undef SHARED_HEADER
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_get_alloc_stats( unsigned long *n_calls, unsigned long *n_bytes )
+     /*----------------------------------------------------------------------*/
+     /* get counters for memory allocated by UNU.RAN                         */
+     /*                                                                      */
+     /* parameters:                                                          */
+     /*   n_calls ... number of calls to malloc() and realloc()              */
+     /*   n_bytes ... number of requested bytes                              */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+#ifdef UNUR_ENABLE_ALLOC_STATS
+  if (n_calls) *n_calls = _unur_alloc_n_calls;
+  if (n_bytes) *n_bytes = _unur_alloc_n_bytes;
+  return UNUR_SUCCESS;
+#else
+  if (n_calls) *n_calls = 0ul;
+  if (n_bytes) *n_bytes = 0ul;
+  _unur_error(NULL,UNUR_ERR_COMPILE,"configure with '--enable-alloc-stats'");
+  return UNUR_ERR_COMPILE;
+#endif
+} /* end of unur_get_alloc_stats() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+unur_reset_alloc_stats( void )
+     /*----------------------------------------------------------------------*/
+     /* reset counters for memory allocated by UNU.RAN                       */
+     /*                                                                      */
+     /* return:                                                              */
+     /*   UNUR_SUCCESS ... on success                                        */
+     /*   error code   ... on error                                          */
+     /*----------------------------------------------------------------------*/
+{
+#ifdef UNUR_ENABLE_ALLOC_STATS
+  _unur_alloc_n_calls = 0ul;
+  _unur_alloc_n_bytes = 0ul;
+  return UNUR_SUCCESS;
+#else
+  _unur_error(NULL,UNUR_ERR_COMPILE,"configure with '--enable-alloc-stats'");
+  return UNUR_ERR_COMPILE;
+#endif
+} /* end of unur_reset_alloc_stats() */
+
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,91 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNURAN -- Universal Non-Uniform Random number generator          *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: umalloc.h                                                         *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         defines function prototypes for counting allocated memory         *
+ *                                                                           *
+ *   USAGE:                                                                  *
+ *         only included in unuran.h and unur_source.h                       *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2000-2006 Wolfgang Hoermann and Josef Leydold             *
+ *   Department of Statistics and Mathematics, WU Wien, Austria              *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+#ifndef UMALLOC_H_SEEN
+#define UMALLOC_H_SEEN
+/*---------------------------------------------------------------------------*/
+
+/* 
+   =NODE Memory Memory allocation
+
+   =UP Misc [10]
+
+   =DESCRIPTION
+      The library can count the calls to its internal memory
+      allocation routines and the number of requested bytes.
+      This feature must be enabled when building the library using the
+      @code{--enable-alloc-stats} configure flag.
+      The memory occupied by a particular generator object can be
+      obtained by unur_gen_get_memory_usage().
+
+   =END
+*/
+
+/*---------------------------------------------------------------------------*/
+
+/* =ROUTINES */
+
+int unur_get_alloc_stats( unsigned long *n_calls, unsigned long *n_bytes );
+/* 
+   Get the total number of calls @var{n_calls} to the internal
+   memory allocation routines of the library and the total number of
+   bytes @var{n_bytes} requested by these calls since the start of the
+   program (or the last call to unur_reset_alloc_stats()).
+   Each call to @code{realloc()} is counted with the new size of
+   the memory block. Memory that is freed is not subtracted.
+   Either of these pointers may be NULL.
+
+   These counters are only available if the library has been compiled
+   with the configure flag @code{--enable-alloc-stats}.
+   Otherwise, both counters are set to @code{0} and error code
+   @code{UNUR_ERR_COMPILE} is returned.
+
+   @emph{Important:} The counters are global and are not protected
+   against concurrent access. Thus they are not reliable when generator
+   objects are created in several threads simultaneously.
+*/
+
+int unur_reset_alloc_stats( void );
+/* 
+   Reset counters for memory allocation (see unur_get_alloc_stats()).
+*/
+
+/* =END */
+
+/*---------------------------------------------------------------------------*/
+#endif  /* UMALLOC_H_SEEN */
+/*---------------------------------------------------------------------------*/
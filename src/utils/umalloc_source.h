@@ -38,3 +38,32 @@
 void *_unur_xmalloc(size_t size)             ATTRIBUTE__MALLOC;
 void *_unur_xrealloc(void *ptr, size_t size) ATTRIBUTE__MALLOC;
 /*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/* Memory blocks with reference counter (copy-on-write).                     */
+/* Such blocks can be shared by several objects (e.g. a distribution object  */
+/* and its clones). They must only be modified after a call to               */
+/* _unur_shared_own() and must be freed by _unur_shared_free().              */
+
+void *_unur_xmalloc_shared(size_t size)             ATTRIBUTE__MALLOC;
+/* allocate memory block with reference counter 1                            */
+
+void *_unur_xrealloc_shared(void *ptr, size_t size) ATTRIBUTE__MALLOC;
+/* reallocate memory block (a new block is allocated if it is shared)        */
+
+void *_unur_shared_ref(void *ptr);
+/* add reference to memory block (returns ptr)                               */
+
+void *_unur_shared_own(void *ptr, size_t size);
+/* make private copy of memory block if it is shared (copy-on-write).        */
+/* if ptr is NULL then a new block of given size is allocated.               */
+
+void _unur_shared_free(void *ptr);
+/* remove reference to memory block and free it if it is not used any more   */
+
+int _unur_shared_n_refs(const void *ptr);
+/* number of references to memory block                                      */
+
+size_t _unur_shared_memsize(const void *ptr);
+/* size of memory block divided by number of references                      */
+/*---------------------------------------------------------------------------*/
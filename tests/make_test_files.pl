@@ -950,6 +950,7 @@ sub print_test_command {
 	  last SWITCH;
       }
       if ($test_command =~ /^\s*compare_sequence_gen\s*$/ or
+	  $test_command =~ /^\s*compare_sequence_gen_array\s*$/ or
 	  $test_command =~ /^\s*compare_sequence_gen_start\s*$/ ) {
 	  $test_command =~ s/\s+//g;
 	  print "$last_C_line\;\n";
@@ -77,10 +77,12 @@ static int compare_doubles ( double x1, double x2 );
 /* compare double sequences generated by generator */
 static int compare_double_sequence_gen_start ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
 static int compare_double_sequence_gen       ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
+static int compare_double_sequence_gen_array ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
 
 /* compare int sequences generated by generator    */
 static int compare_int_sequence_gen_start    ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
 static int compare_int_sequence_gen          ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
+static int compare_int_sequence_gen_array    ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
 
 /* compare sequences of double vectors generated by generator */
 static int compare_cvec_sequence_gen_start   ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
@@ -607,6 +609,31 @@ compare_sequence_gen ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size )
   }
 } /* end of compare_sequence_gen() */
 
+int 
+compare_sequence_gen_array ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size )
+{
+  if (gen == NULL) return UNUR_FAILURE;
+
+  /* reset uniform RNG */
+  if (unur_urng_reset(unur_get_urng(gen)) != UNUR_SUCCESS) 
+    return cannot_compare_sequence(LOG);
+
+  switch( unur_distr_get_type(unur_get_distr(gen)) ) {
+
+  case UNUR_DISTR_CONT:
+  case UNUR_DISTR_CEMP:
+  case 0:  /* method UNIF */
+    return compare_double_sequence_gen_array(LOG,line,gen,sample_size );
+
+  case UNUR_DISTR_DISCR:
+    return compare_int_sequence_gen_array(LOG,line,gen,sample_size );
+
+  default:
+    fprintf(stderr,"\ncannot handle distribution type! ... aborted\n");
+    exit (EXIT_FAILURE);
+  }
+} /* end of compare_sequence_gen_array() */
+
 /*---------------------------------------------------------------------------*/
 
 int
@@ -759,6 +786,52 @@ int compare_double_sequence_gen( FILE *LOG, int line, UNUR_GEN *gen, int sample_
 
 } /* end of compare_double_sequence_gen() */
 
+/*...........................................................................*/
+
+int compare_double_sequence_gen_array( FILE *LOG, int line, UNUR_GEN *gen, int sample_size )
+{
+  int i;
+  int ok = TRUE;
+  double *x;
+  int failed = 0;
+
+  /* check generator object and stored sequence */
+  if (gen==NULL || double_sequence_A==NULL) {
+    /* error */
+    return UNUR_FAILURE;
+  }
+
+  /* generate sequence as array */
+  x = malloc( sample_size * sizeof(double) );
+  abort_if_NULL(LOG,line, x);
+  if (unur_sample_cont_array(gen,x,sample_size) != UNUR_SUCCESS)
+    ok = FALSE;
+
+  /* compare sequence */
+  for (i=0; ok && i<sample_size; i++) {
+    if (!compare_doubles(double_sequence_A[i], x[i])) {
+      ok = FALSE;
+      break;
+    }
+  }
+
+  /* print result */
+  fprintf(LOG,"line %4d: random seqences (array) ...\t",line);
+  if (!ok) {
+    failed = 1;
+    fprintf(LOG," Failed\n");
+    if (i<sample_size)
+      fprintf(LOG,"\tx[1] = %g, x[2] = %g, diff = %g\n",double_sequence_A[i],x[i],double_sequence_A[i]-x[i]);
+  }
+  else
+    fprintf(LOG," ok\n");
+  
+  free(x);
+  fflush(LOG);
+  return (failed ? UNUR_FAILURE : UNUR_SUCCESS);
+
+} /* end of compare_double_sequence_gen_array() */
+
 /*---------------------------------------------------------------------------*/
 /* compare int sequences generated by generator    */
 /* only when when we can reset the uniform RNG     */
@@ -827,6 +900,49 @@ int compare_int_sequence_gen( FILE *LOG, int line, UNUR_GEN *gen, int sample_siz
 
 } /* end of compare_int_sequence_gen() */
 
+/*...........................................................................*/
+
+int compare_int_sequence_gen_array( FILE *LOG, int line, UNUR_GEN *gen, int sample_size )
+{
+  int i;
+  int ok = TRUE;
+  int *k;
+  int failed = 0;
+
+  /* check generator object and stored sequence */
+  if (gen==NULL || int_sequence_A==NULL) {
+    /* error */
+    return UNUR_FAILURE;
+  }
+
+  /* generate sequence as array */
+  k = malloc( sample_size * sizeof(int) );
+  abort_if_NULL(LOG,line, k);
+  if (unur_sample_discr_array(gen,k,sample_size) != UNUR_SUCCESS)
+    ok = FALSE;
+
+  /* compare sequence */
+  for (i=0; ok && i<sample_size; i++)
+    if (int_sequence_A[i] != k[i]) {
+      ok = FALSE;
+      break;
+    }
+  
+  /* print result */
+  fprintf(LOG,"line %4d: random seqences (array) ...\t",line);
+  if (!ok) {
+    failed = 1;
+    fprintf(LOG," Failed\n");
+  }
+  else
+    fprintf(LOG," ok\n");
+  
+  free(k);
+  fflush(LOG);
+  return (failed ? UNUR_FAILURE : UNUR_SUCCESS);
+
+} /* end of compare_int_sequence_gen_array() */
+
 /*---------------------------------------------------------------------------*/
 /* compare sequences of double vectors generated by generator */
 /* only when when we can reset the uniform RNG                */
@@ -213,6 +213,7 @@ int check_expected_no_reinit( FILE *LOG, int line, int rcode );
 /* compare sequences generated by generator */
 int compare_sequence_gen_start ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
 int compare_sequence_gen       ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
+int compare_sequence_gen_array ( FILE *LOG, int line, UNUR_GEN *gen, int sample_size );
 int compare_sequence_par_start ( FILE *LOG, int line, UNUR_PAR *par, int sample_size );
 int compare_sequence_par       ( FILE *LOG, int line, UNUR_PAR *par, int sample_size );
 int compare_sequence_urng_start( FILE *LOG, int line, int sample_size );